@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compileServer.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <string_view>
+
+#if defined(PANDA_TARGET_UNIX)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace panda::es2panda::aot {
+constexpr std::string_view SERVER_OPTION = "--server";
+constexpr std::string_view SERVER_SOCKET_OPTION = "--server-socket";
+constexpr std::string_view SERVER_STOP_REQUEST = "--server-stop";
+constexpr const char *PROGRAM_NAME = "es2panda";
+
+bool CompileServer::IsServerMode(int argc, const char **argv)
+{
+    return argc > 1 && (argv[1] == SERVER_OPTION || argv[1] == SERVER_SOCKET_OPTION);
+}
+
+int CompileServer::Serve(int argc, const char **argv)
+{
+    if (argv[1] == SERVER_OPTION && argc == 2) {
+        // Diagnostics and dumps of the compilations are printed to std::cout, they would be taken for replies.
+        // Replies keep the original stdout, everything the compiler prints goes to stderr while serving.
+        std::ostream reply(std::cout.rdbuf());
+        std::cout.rdbuf(std::cerr.rdbuf());
+        int ret = ServeStream(std::cin, reply);
+        std::cout.rdbuf(reply.rdbuf());
+        return ret;
+    }
+
+    if (argv[1] == SERVER_SOCKET_OPTION && argc == 3) {
+        return ServeSocket(argv[2]);
+    }
+
+    std::cerr << "Usage: " << PROGRAM_NAME << " " << SERVER_OPTION << " | " << SERVER_SOCKET_OPTION << " <path>"
+              << std::endl;
+    return 1;
+}
+
+std::vector<std::string> CompileServer::SplitRequest(const std::string &line)
+{
+    // Arguments are separated by whitespace, double quotes group an argument containing spaces
+    std::vector<std::string> args;
+    std::string current;
+    bool quoted = false;
+    bool hasArg = false;
+
+    for (char c : line) {
+        if (c == '"') {
+            quoted = !quoted;
+            hasArg = true;
+        } else if (!quoted && std::isspace(static_cast<unsigned char>(c))) {
+            if (hasArg) {
+                args.push_back(std::move(current));
+                current.clear();
+                hasArg = false;
+            }
+        } else {
+            current += c;
+            hasArg = true;
+        }
+    }
+
+    if (hasArg) {
+        args.push_back(std::move(current));
+    }
+
+    return args;
+}
+
+int CompileServer::HandleRequest(const std::string &line)
+{
+    std::vector<std::string> args = SplitRequest(line);
+    std::vector<const char *> argv;
+    argv.reserve(args.size() + 1);
+    argv.push_back(PROGRAM_NAME);
+    for (const auto &arg : args) {
+        argv.push_back(arg.c_str());
+    }
+
+    int ret = 1;
+    // A failing request must not take the server and the requests queued behind it down
+    try {
+        ret = handler_(static_cast<int>(argv.size()), argv.data());
+    } catch (const std::exception &e) {
+        std::cerr << "Request failed: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "Request failed with an unknown error" << std::endl;
+    }
+
+    // Compiler output shares the server streams, so it has to be complete before the reply is sent
+    std::cout.flush();
+    std::cerr.flush();
+    return ret;
+}
+
+int CompileServer::ServeStream(std::istream &in, std::ostream &out)
+{
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        if (line == SERVER_STOP_REQUEST) {
+            break;
+        }
+
+        out << HandleRequest(line) << std::endl;
+    }
+
+    return 0;
+}
+
+#if defined(PANDA_TARGET_UNIX)
+static bool WriteReply(int fd, int ret)
+{
+    std::string reply = std::to_string(ret) + "\n";
+    size_t written = 0;
+    while (written < reply.size()) {
+        ssize_t n = write(fd, reply.data() + written, reply.size() - written);
+        if (n <= 0) {
+            return false;
+        }
+        written += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+int CompileServer::ServeSocket(const std::string &path)
+{
+    sockaddr_un addr {};
+    if (path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "Socket path is too long: " << path << std::endl;
+        return 1;
+    }
+
+    int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        std::cerr << "Failed to create socket: " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+
+    addr.sun_family = AF_UNIX;
+    std::copy(path.begin(), path.end(), addr.sun_path);
+    unlink(path.c_str());
+
+    if (bind(listenFd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 || listen(listenFd, SOMAXCONN) != 0) {
+        std::cerr << "Failed to listen on " << path << ": " << std::strerror(errno) << std::endl;
+        close(listenFd);
+        return 1;
+    }
+
+    bool stop = false;
+    constexpr size_t BUFFER_SIZE = 4096;
+    std::array<char, BUFFER_SIZE> buffer {};
+
+    // Connections are served one at a time, each compilation already runs on the file and function workers
+    while (!stop) {
+        int connFd = accept(listenFd, nullptr, nullptr);
+        if (connFd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        std::string pending;
+        ssize_t n = 0;
+        while (!stop && (n = read(connFd, buffer.data(), buffer.size())) > 0) {
+            pending.append(buffer.data(), static_cast<size_t>(n));
+            size_t pos = 0;
+            while ((pos = pending.find('\n')) != std::string::npos) {
+                std::string line = pending.substr(0, pos);
+                pending.erase(0, pos + 1);
+                if (line.empty()) {
+                    continue;
+                }
+                if (line == SERVER_STOP_REQUEST) {
+                    stop = true;
+                    break;
+                }
+                if (!WriteReply(connFd, HandleRequest(line))) {
+                    break;
+                }
+            }
+        }
+
+        close(connFd);
+    }
+
+    close(listenFd);
+    unlink(path.c_str());
+    return 0;
+}
+#else
+int CompileServer::ServeSocket(const std::string &path)
+{
+    std::cerr << SERVER_SOCKET_OPTION << " is not supported on this platform: " << path << std::endl;
+    return 1;
+}
+#endif
+}  // namespace panda::es2panda::aot
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ES2PANDA_AOT_COMPILESERVER_H
+#define ES2PANDA_AOT_COMPILESERVER_H
+
+#include <macros.h>
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace panda::es2panda::aot {
+/*
+ * Long-running driver mode: every request is one line holding the same arguments as the command line,
+ * and is answered with a line carrying the exit code of the compilation. The memory subsystem stays
+ * initialized between requests, so only the first one pays for MemConfig/PoolManager setup. Worker threads and
+ * cache files belong to a request, they are created and released by every compilation.
+ *
+ *   es2panda --server                  read requests from stdin, answer on stdout, compiler output goes to stderr
+ *   es2panda --server-socket <path>    accept connections on a unix domain socket
+ */
+class CompileServer {
+public:
+    using RequestHandler = std::function<int(int, const char **)>;
+
+    explicit CompileServer(RequestHandler handler) : handler_(std::move(handler)) {}
+    NO_COPY_SEMANTIC(CompileServer);
+    NO_MOVE_SEMANTIC(CompileServer);
+    ~CompileServer() = default;
+
+    static bool IsServerMode(int argc, const char **argv);
+    int Serve(int argc, const char **argv);
+
+private:
+    static std::vector<std::string> SplitRequest(const std::string &line);
+    int HandleRequest(const std::string &line);
+    int ServeStream(std::istream &in, std::ostream &out);
+    int ServeSocket(const std::string &path);
+
+    RequestHandler handler_;
+};
+}  // namespace panda::es2panda::aot
+
+#endif  // ES2PANDA_AOT_COMPILESERVER_H
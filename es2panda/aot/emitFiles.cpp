@@ -48,6 +48,9 @@ void EmitFileQueue::Schedule()
         jobsCount_++;
     } else {
         for (const auto &info: progsInfo_) {
+            if (info.second->emitted) {
+                continue;
+            }
             try {
                 // generate multi abcs
                 auto outputFileName = options_->OutputFiles().empty() ? options_->CompilerOutput() :
@@ -15,18 +15,24 @@
 
 #include <assembly-program.h>
 #include <assembly-emitter.h>
+#include <compileServer.h>
 #include <emitFiles.h>
 #include <es2panda.h>
 #include <mem/arena_allocator.h>
 #include <mem/pool_manager.h>
 #include <options.h>
 #include <protobufSnapshotGenerator.h>
+#include <util/arenaStatistics.h>
 #include <util/dumper.h>
+#include <util/literalArrayDedup.h>
 #include <util/moduleHelpers.h>
 #include <util/programCache.h>
+#include <util/wholeProgramOptimizer.h>
 #include <util/workerQueue.h>
 #include <abc2program/program_dump.h>
 
+#include <atomic>
+#include <cstdio>
 #include <iostream>
 
 namespace panda::es2panda::aot {
@@ -51,6 +57,40 @@ public:
     }
 };
 
+// Statistics are collected per request, every way out of a compilation has to drop what it recorded
+class ArenaStatisticsGuard {
+public:
+    ArenaStatisticsGuard() = default;
+    NO_COPY_SEMANTIC(ArenaStatisticsGuard);
+    NO_MOVE_SEMANTIC(ArenaStatisticsGuard);
+
+    ~ArenaStatisticsGuard()
+    {
+        util::ArenaStatistics::Reset();
+        util::ArenaStatistics::Enable(false);
+    }
+};
+
+// The caches are placed into the arena of a compilation, they are destroyed before the arena is released
+class ProgramCachesGuard {
+public:
+    explicit ProgramCachesGuard(std::map<std::string, panda::es2panda::util::ProgramCache*> &programsInfo)
+        : programsInfo_(programsInfo)
+    {
+    }
+
+    NO_COPY_SEMANTIC(ProgramCachesGuard);
+    NO_MOVE_SEMANTIC(ProgramCachesGuard);
+
+    ~ProgramCachesGuard()
+    {
+        util::DestroyProgramCaches(programsInfo_);
+    }
+
+private:
+    std::map<std::string, panda::es2panda::util::ProgramCache*> &programsInfo_;
+};
+
 static void GenerateBase64Output(panda::pandasm::Program *prog)
 {
     auto pandaFile = panda::pandasm::AsmEmitter::Emit(*prog);
@@ -111,6 +151,36 @@ static void DumpPandaFileSizePctStatistic(std::map<std::string, size_t> &stat)
     std::cout << "total: " << totalSize << std::endl;
 }
 
+static void DumpLexicalEnvStatistic(const std::map<std::string, panda::es2panda::util::ProgramCache*> &programsInfo)
+{
+    size_t instructions = 0;
+    size_t newLexEnvs = 0;
+    size_t popLexEnvs = 0;
+    for (const auto &[name, cache] : programsInfo) {
+        for (const auto &[funcName, function] : cache->program.function_table) {
+            instructions += function.ins.size();
+            for (const auto &ins : function.ins) {
+                switch (ins.opcode) {
+                    case panda::pandasm::Opcode::NEWLEXENV:
+                    case panda::pandasm::Opcode::WIDE_NEWLEXENV:
+                    case panda::pandasm::Opcode::NEWLEXENVWITHNAME:
+                    case panda::pandasm::Opcode::WIDE_NEWLEXENVWITHNAME:
+                        newLexEnvs++;
+                        break;
+                    case panda::pandasm::Opcode::POPLEXENV:
+                        popLexEnvs++;
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+    }
+
+    std::cout << "Lexical environments: " << newLexEnvs << " created, " << popLexEnvs << " popped in "
+              << instructions << " instructions" << std::endl;
+}
+
 static bool GenerateProgramsByWorkers(const std::map<std::string, panda::es2panda::util::ProgramCache*> &programsInfo,
     const std::unique_ptr<panda::es2panda::aot::Options> &options, std::map<std::string, size_t> *statp)
 {
@@ -154,19 +224,38 @@ static void DumpProgramInfos(const std::map<std::string, panda::es2panda::util::
     }
 }
 
+static bool CanRewriteMergedPrograms(const std::unique_ptr<panda::es2panda::aot::Options> &options)
+{
+    // Type info and patch symbol tables refer to literal arrays and functions of their own record
+    const es2panda::CompilerOptions &compilerOptions = options->CompilerOptions();
+    return compilerOptions.mergeAbc && !compilerOptions.typeExtractor &&
+        compilerOptions.patchFixOptions.symbolTable.empty() && compilerOptions.patchFixOptions.dumpSymbolTable.empty();
+}
+
+static bool CanDeduplicateLiterals(const std::unique_ptr<panda::es2panda::aot::Options> &options)
+{
+    return options->DedupLiteralArrays() && CanRewriteMergedPrograms(options);
+}
+
+static bool CanOptimizeWholeProgram(const std::unique_ptr<panda::es2panda::aot::Options> &options)
+{
+    // Debugging keeps the code as written
+    return options->MergeAbcOpt() && CanRewriteMergedPrograms(options) && !options->CompilerOptions().isDebug;
+}
+
 static bool GenerateProgram(const std::map<std::string, panda::es2panda::util::ProgramCache*> &programsInfo,
     const std::unique_ptr<panda::es2panda::aot::Options> &options)
 {
-    DumpProgramInfos(programsInfo, options);
-
     if (programsInfo.size() == 1) {
         auto *prog = &(programsInfo.begin()->second->program);
         if (options->OutputFiles().empty() && options->CompilerOutput().empty()) {
+            DumpProgramInfos(programsInfo, options);
             GenerateBase64Output(prog);
             return true;
         }
 
         if (options->compilerProtoOutput().size() > 0) {
+            DumpProgramInfos(programsInfo, options);
             panda::proto::ProtobufSnapshotGenerator::GenerateSnapshot(*prog, options->compilerProtoOutput());
             return true;
         }
@@ -177,18 +266,46 @@ static bool GenerateProgram(const std::map<std::string, panda::es2panda::util::P
     std::map<std::string, size_t> stat;
     std::map<std::string, size_t> *statp = (dumpSize || dumpSizePct) ? &stat : nullptr;
 
+    util::WholeProgramOptimizer wholeProgramOptimizer;
+    bool optimizeWholeProgram = CanOptimizeWholeProgram(options);
+    if (optimizeWholeProgram) {
+        wholeProgramOptimizer.Run(programsInfo, options->CompilerOptions().cacheFiles);
+    }
+
+    util::LiteralArrayDedup literalArrayDedup;
+    bool dedupLiterals = CanDeduplicateLiterals(options);
+    if (dedupLiterals) {
+        literalArrayDedup.Run(programsInfo, options->CompilerOptions().cacheFiles);
+    }
+
+    // The dumps show the programs as they are emitted
+    DumpProgramInfos(programsInfo, options);
+
     if (!GenerateProgramsByWorkers(programsInfo, options, statp)) {
         return false;
     }
 
     if (dumpSize) {
-        DumpPandaFileSizeStatistic(stat);
+        if (optimizeWholeProgram) {
+            wholeProgramOptimizer.DumpStatistic(std::cout);
+        }
+        if (dedupLiterals) {
+            literalArrayDedup.DumpStatistic(std::cout);
+        }
+        // The merged abc is emitted without section statistics
+        if (!stat.empty()) {
+            DumpPandaFileSizeStatistic(stat);
+        }
     }
 
-    if (dumpSizePct) {
+    if (dumpSizePct && !stat.empty()) {
         DumpPandaFileSizePctStatistic(stat);
     }
 
+    if (options->LexicalEnvStat()) {
+        DumpLexicalEnvStatistic(programsInfo);
+    }
+
     return true;
 }
 
@@ -209,8 +326,60 @@ static bool GenerateAbcFiles(const std::map<std::string, panda::es2panda::util::
     return true;
 }
 
+static bool CanEmitWhileCompiling(const std::unique_ptr<panda::es2panda::aot::Options> &options)
+{
+    // Programs are kept until every file is compiled when they are merged, dumped or measured together
+    const es2panda::CompilerOptions &compilerOptions = options->CompilerOptions();
+    return !compilerOptions.mergeAbc && !options->OutputFiles().empty() && options->compilerProtoOutput().empty() &&
+        !compilerOptions.dumpAsm && !compilerOptions.dumpLiteralBuffer && !compilerOptions.dumpAsmProgram &&
+        !options->SizeStat() && !options->SizePctStat();
+}
+
+static void EmitCompiledProgram(const std::unique_ptr<panda::es2panda::aot::Options> &options,
+    const std::string &fileName, panda::es2panda::util::ProgramCache *cache, std::atomic<bool> *emitFailed)
+{
+    auto outputFileIter = options->OutputFiles().find(fileName);
+    if (outputFileIter == options->OutputFiles().end()) {
+        std::cerr << "No output file is specified for " << fileName << std::endl;
+        *emitFailed = true;
+        return;
+    }
+
+    // The error is reported here only, the failure is returned by the driver once every file is compiled
+    try {
+        EmitSingleAbcJob emitJob(outputFileIter->second, &(cache->program), nullptr,
+                                 options->CompilerOptions().targetApiVersion);
+        emitJob.Run();
+    } catch (const class Error &e) {
+        std::cerr << e.Message() << std::endl;
+        std::remove(panda::os::file::File::GetExtendedFilePath(outputFileIter->second).c_str());
+        *emitFailed = true;
+        return;
+    }
+
+    // Release the program right away, peak memory is then bounded by the files being compiled
+    cache->program = panda::pandasm::Program();
+    cache->emitted = true;
+}
+
+static void RemoveEmittedOutputs(const std::map<std::string, panda::es2panda::util::ProgramCache*> &programsInfo,
+    const std::unique_ptr<panda::es2panda::aot::Options> &options)
+{
+    // A failed build leaves no output behind, like it does when the files are emitted after the compilation
+    for (const auto &[fileName, cache] : programsInfo) {
+        if (!cache->emitted) {
+            continue;
+        }
+        auto outputFileIter = options->OutputFiles().find(fileName);
+        if (outputFileIter != options->OutputFiles().end()) {
+            std::remove(panda::os::file::File::GetExtendedFilePath(outputFileIter->second).c_str());
+        }
+    }
+}
+
 int Run(int argc, const char **argv)
 {
+    ArenaStatisticsGuard arenaStatisticsGuard;
     auto options = std::make_unique<Options>();
     if (!options->Parse(argc, argv)) {
         std::cerr << options->ErrorMsg() << std::endl;
@@ -225,15 +394,32 @@ int Run(int argc, const char **argv)
         return 0;
     }
 
+    util::ArenaStatistics::Enable(options->ArenaStat());
+
     std::map<std::string, panda::es2panda::util::ProgramCache*> programsInfo;
     size_t expectedProgsCount = options->CompilerOptions().sourceFiles.size();
     panda::ArenaAllocator allocator(panda::SpaceType::SPACE_TYPE_COMPILER, nullptr, true);
+    // The compile server runs many requests in one process, nothing of a request may outlive it
+    ProgramCachesGuard programCachesGuard(programsInfo);
+
+    util::EmitProgramCallback emitProgram = nullptr;
+    std::atomic<bool> emitFailed {false};
+    if (CanEmitWhileCompiling(options)) {
+        emitProgram = [&options, &emitFailed](const std::string &fileName, util::ProgramCache *cache) {
+            EmitCompiledProgram(options, fileName, cache, &emitFailed);
+        };
+    }
 
-    int ret = Compiler::CompileFiles(options->CompilerOptions(), programsInfo, &allocator);
+    int ret = Compiler::CompileFiles(options->CompilerOptions(), programsInfo, &allocator, emitProgram);
     if (options->ParseOnly()) {
         return ret;
     }
 
+    if (emitProgram && (ret != 0 || emitFailed)) {
+        RemoveEmittedOutputs(programsInfo, options);
+        return 1;
+    }
+
     if (!options->NpmModuleEntryList().empty()) {
         es2panda::util::ModuleHelpers::CompileNpmModuleEntryList(options->NpmModuleEntryList(),
             options->CompilerOptions(), programsInfo, &allocator);
@@ -244,6 +430,11 @@ int Run(int argc, const char **argv)
         return 1;
     }
 
+    if (options->ArenaStat()) {
+        util::ArenaStatistics::Record("<driver>", util::ArenaStatistics::PHASE_DRIVER, &allocator);
+        util::ArenaStatistics::Dump(std::cout);
+    }
+
     return 0;
 }
 }  // namespace panda::es2panda::aot
@@ -251,5 +442,9 @@ int Run(int argc, const char **argv)
 int main(int argc, const char **argv)
 {
     panda::es2panda::aot::MemManager mm;
+    if (panda::es2panda::aot::CompileServer::IsServerMode(argc, argv)) {
+        panda::es2panda::aot::CompileServer server(panda::es2panda::aot::Run);
+        return server.Serve(argc, argv);
+    }
     return panda::es2panda::aot::Run(argc, argv);
 }
@@ -214,6 +214,10 @@ bool Options::Parse(int argc, const char **argv)
     panda::PandArg<bool> opDumpTransformedAst("dump-transformed-ast", false, "Dump the parsed AST after transform");
     panda::PandArg<bool> opCheckTransformedAstStructure("check-transformed-ast-structure", false,
                                                         "Check the AST structure after transform");
+    panda::PandArg<bool> opForceTsTransform("force-ts-transform", false,
+        "Run the TS transformer and the binding after it even if the input has nothing to transform");
+    panda::PandArg<bool> opDumpTsTransformStatus("dump-ts-transform-status", false,
+        "Print whether the TS input is transformed and bound twice or bound in a single pass");
     panda::PandArg<bool> opRecordSource("record-source", false, "Record all functions' source codes to support the "\
         "using of [function].toString()");
 
@@ -234,6 +238,10 @@ bool Options::Parse(int argc, const char **argv)
     panda::PandArg<bool> opSizeStat("dump-size-stat", false, "Dump size statistics");
     panda::PandArg<bool> opSizePctStat("dump-file-item-size", false, "Dump the size of each kind of file item "\
         "of the abc file");
+    panda::PandArg<bool> opArenaStat("dump-arena-stat", false, "Dump arena memory statistics by file and by "\
+        "compilation phase");
+    panda::PandArg<bool> opLexicalEnvStat("dump-lexical-env-stat", false, "Dump the number of instructions "\
+        "creating and popping lexical environments");
     panda::PandArg<bool> opDumpLiteralBuffer("dump-literal-buffer", false, "Dump literal buffer");
     panda::PandArg<std::string> outputFile("output", "", "Compiler binary output (.abc)");
     panda::PandArg<std::string> recordName("record-name", "", "Specify the record name");
@@ -248,8 +256,14 @@ bool Options::Parse(int argc, const char **argv)
     panda::PandArg<std::string> opCacheFile("cache-file", "", "cache file for incremental compile");
     panda::PandArg<std::string> opNpmModuleEntryList("npm-module-entry-list", "", "entry list file for module compile");
     panda::PandArg<bool> opMergeAbc("merge-abc", false, "Compile as merge abc");
+    panda::PandArg<bool> opMergeAbcOpt("merge-abc-opt", false, "Remove unreferenced functions and fold constant "\
+        "module variables of the merged abc");
+    panda::PandArg<bool> opDedupLiteralArrays("dedup-literal-arrays", false, "Share literal arrays with equal "\
+        "content between the records of the merged abc");
     panda::PandArg<bool> opuseDefineSemantic("use-define-semantic", false, "Compile ts class fields "\
         "in accordance with ECMAScript2022");
+    panda::PandArg<bool> opHoistLoopLexicals("hoist-loop-lexicals", false, "Move the variables of loops only "\
+        "captured by immediately invoked closures into an enclosing lexical environment");
 
     // patchfix && hotreload
     panda::PandArg<std::string> opDumpSymbolTable("dump-symbol-table", "", "dump symbol table to file");
@@ -274,6 +288,8 @@ bool Options::Parse(int argc, const char **argv)
     argparser_->Add(&opDumpAst);
     argparser_->Add(&opDumpTransformedAst);
     argparser_->Add(&opCheckTransformedAstStructure);
+    argparser_->Add(&opForceTsTransform);
+    argparser_->Add(&opDumpTsTransformStatus);
     argparser_->Add(&opRecordSource);
     argparser_->Add(&opParseOnly);
     argparser_->Add(&opEnableTypeCheck);
@@ -293,6 +309,8 @@ bool Options::Parse(int argc, const char **argv)
     argparser_->Add(&opFileThreadCount);
     argparser_->Add(&opSizeStat);
     argparser_->Add(&opSizePctStat);
+    argparser_->Add(&opArenaStat);
+    argparser_->Add(&opLexicalEnvStat);
     argparser_->Add(&opDumpLiteralBuffer);
 
     argparser_->Add(&inputExtension);
@@ -303,7 +321,10 @@ bool Options::Parse(int argc, const char **argv)
     argparser_->Add(&opCacheFile);
     argparser_->Add(&opNpmModuleEntryList);
     argparser_->Add(&opMergeAbc);
+    argparser_->Add(&opMergeAbcOpt);
+    argparser_->Add(&opDedupLiteralArrays);
     argparser_->Add(&opuseDefineSemantic);
+    argparser_->Add(&opHoistLoopLexicals);
 
     argparser_->Add(&opDumpSymbolTable);
     argparser_->Add(&opInputSymbolTable);
@@ -474,6 +495,22 @@ bool Options::Parse(int argc, const char **argv)
         options_ |= OptionFlags::SIZE_PCT_STAT;
     }
 
+    if (opArenaStat.GetValue()) {
+        options_ |= OptionFlags::ARENA_STAT;
+    }
+
+    if (opMergeAbcOpt.GetValue()) {
+        options_ |= OptionFlags::MERGE_ABC_OPT;
+    }
+
+    if (opDedupLiteralArrays.GetValue()) {
+        options_ |= OptionFlags::DEDUP_LITERAL_ARRAYS;
+    }
+
+    if (opLexicalEnvStat.GetValue()) {
+        options_ |= OptionFlags::LEXICAL_ENV_STAT;
+    }
+
     compilerOptions_.recordSource = opRecordSource.GetValue();
     compilerOptions_.enableAbcInput = opEnableAbcInput.GetValue();
     compilerOptions_.dumpAsmProgram = opDumpAsmProgram.GetValue();
@@ -481,12 +518,15 @@ bool Options::Parse(int argc, const char **argv)
     compilerOptions_.dumpAst = opDumpAst.GetValue();
     compilerOptions_.dumpTransformedAst = opDumpTransformedAst.GetValue();
     compilerOptions_.checkTransformedAstStructure = opCheckTransformedAstStructure.GetValue();
+    compilerOptions_.forceTsTransform = opForceTsTransform.GetValue();
+    compilerOptions_.dumpTsTransformStatus = opDumpTsTransformStatus.GetValue();
     compilerOptions_.dumpDebugInfo = opDumpDebugInfo.GetValue();
     compilerOptions_.isDebug = opDebugInfo.GetValue();
     compilerOptions_.parseOnly = opParseOnly.GetValue();
     compilerOptions_.enableTypeCheck = opEnableTypeCheck.GetValue();
     compilerOptions_.dumpLiteralBuffer = opDumpLiteralBuffer.GetValue();
     compilerOptions_.isDebuggerEvaluateExpressionMode = debuggerEvaluateExpression.GetValue();
+    compilerOptions_.hoistLoopLexicals = opHoistLoopLexicals.GetValue();
 
     compilerOptions_.functionThreadCount = functionThreadCount_;
     compilerOptions_.fileThreadCount = fileThreadCount_;
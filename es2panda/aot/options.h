@@ -36,6 +36,10 @@ enum class OptionFlags {
     PARSE_ONLY = 1 << 1,
     SIZE_STAT = 1 << 2,
     SIZE_PCT_STAT = 1 << 3,
+    ARENA_STAT = 1 << 4,
+    MERGE_ABC_OPT = 1 << 5,
+    DEDUP_LITERAL_ARRAYS = 1 << 6,
+    LEXICAL_ENV_STAT = 1 << 7,
 };
 
 inline std::underlying_type_t<OptionFlags> operator&(OptionFlags a, OptionFlags b)
@@ -116,6 +120,26 @@ public:
         return (options_ & OptionFlags::SIZE_PCT_STAT) != 0;
     }
 
+    bool ArenaStat() const
+    {
+        return (options_ & OptionFlags::ARENA_STAT) != 0;
+    }
+
+    bool MergeAbcOpt() const
+    {
+        return (options_ & OptionFlags::MERGE_ABC_OPT) != 0;
+    }
+
+    bool DedupLiteralArrays() const
+    {
+        return (options_ & OptionFlags::DEDUP_LITERAL_ARRAYS) != 0;
+    }
+
+    bool LexicalEnvStat() const
+    {
+        return (options_ & OptionFlags::LEXICAL_ENV_STAT) != 0;
+    }
+
     std::string ExtractContentFromBase64Input(const std::string &inputBase64String);
 
     const std::string &compilerProtoOutput() const
@@ -27,7 +27,10 @@
 #include "ir/base/scriptFunction.h"
 #include "ir/base/spreadElement.h"
 #include "ir/expressions/arrayExpression.h"
+#include "ir/expressions/arrowFunctionExpression.h"
 #include "ir/expressions/assignmentExpression.h"
+#include "ir/expressions/callExpression.h"
+#include "ir/expressions/functionExpression.h"
 #include "ir/expressions/identifier.h"
 #include "ir/expressions/objectExpression.h"
 #include "ir/expressions/privateIdentifier.h"
@@ -199,6 +202,7 @@ void Binder::IdentifierAnalysis(ResolveBindingFlags flags)
         if (topScope_->IsModuleScope()) {
             AssignIndexToModuleVariable();
         }
+        HoistLoopLexicals();
     }
 }
 
@@ -329,6 +333,7 @@ void Binder::LookupIdentReference(ir::Identifier *ident)
         !res.variable->HasFlag(VariableFlags::INITIALIZED)) {
         ident->SetTdz();
     }
+    RecordLoopCapture(res, ident);
     // in release mode, replace const reference with its initialization
     if (!this->Program()->IsDebug() && decl->IsConstDecl()) {
         ReplaceConstReferenceWithInitialization(ident, decl);
@@ -337,6 +342,151 @@ void Binder::LookupIdentReference(ir::Identifier *ident)
     ident->SetVariable(res.variable);
 }
 
+void Binder::RecordLoopCapture(const ScopeFindResult &res, const ir::Identifier *ident)
+{
+    if (!(bindingFlags_ & ResolveBindingFlags::ALL) || res.scope == nullptr || res.scope->IsFunctionParamScope() ||
+        !res.variable->IsLocalVariable()) {
+        return;
+    }
+
+    auto *varScope = res.scope->EnclosingVariableScope();
+    if (varScope == nullptr || !varScope->IsLoopScope()) {
+        return;
+    }
+
+    auto *loopScope = varScope->AsLoopScope();
+    if (!res.variable->LexicalBound() && !ident->IsTdz()) {
+        return;
+    }
+
+    if (std::find(capturingLoops_.rbegin(), capturingLoops_.rend(), loopScope) == capturingLoops_.rend()) {
+        capturingLoops_.push_back(loopScope);
+    }
+
+    // A fresh environment per iteration is what makes uninitialized slots holes, which both of these rely on
+    if (ident->IsTdz() || (res.scope->Node() != nullptr && res.scope->Node()->IsSwitchStatement())) {
+        escapingLoops_.insert(loopScope);
+    }
+
+    if (res.level == 0 || !res.variable->LexicalBound()) {
+        return;
+    }
+
+    loopCaptures_.emplace_back(loopScope, res.variable->AsLocalVariable());
+    for (auto *iter = scope_; iter != nullptr && iter != res.scope; iter = iter->Parent()) {
+        if (iter->IsFunctionParamScope()) {
+            loopClosures_.emplace_back(loopScope, iter->AsFunctionParamScope()->GetFunctionScope());
+        } else if (iter->IsFunctionScope()) {
+            loopClosures_.emplace_back(loopScope, iter->AsFunctionScope());
+        } else if (iter->IsFunctionVariableScope() || iter->IsClassScope()) {
+            escapingLoops_.insert(loopScope);
+            return;
+        }
+    }
+}
+
+static bool IsImmediatelyInvoked(const FunctionScope *scope)
+{
+    const auto *node = scope->Node();
+    if (node == nullptr || !node->IsScriptFunction()) {
+        return false;
+    }
+
+    // Named, generator and async functions may outlive the call, as may the arguments object
+    const auto *func = node->AsScriptFunction();
+    if (func->Id() != nullptr || func->IsGenerator() || func->IsAsync() ||
+        scope->HasFlag(VariableScopeFlags::USE_ARGS)) {
+        return false;
+    }
+
+    const auto *expr = func->Parent();
+    if (expr == nullptr || !(expr->IsFunctionExpression() || expr->IsArrowFunctionExpression())) {
+        return false;
+    }
+
+    const auto *call = expr->Parent();
+    return call != nullptr && call->IsCallExpression() && call->AsCallExpression()->Callee() == expr;
+}
+
+void Binder::HoistLoopLexicals()
+{
+    // Slots of patched functions come from the symbol table, debug info keeps every environment as written
+    if (!Program()->HoistLoopLexicals() || program_->PatchFixHelper() != nullptr || Program()->IsDebug()) {
+        return;
+    }
+
+    for (const auto &[loopScope, closure] : loopClosures_) {
+        if (!IsImmediatelyInvoked(closure)) {
+            escapingLoops_.insert(loopScope);
+        }
+    }
+
+    /*
+     * Variables of a loop only captured by closures that are called right away never outlive the iteration, so a
+     * single slot in the closest environment that stays can hold them for every iteration. The loop then does not
+     * create and pop an environment each time around.
+     */
+    auto byLoop = [](const std::pair<LoopScope *, LocalVariable *> &a,
+                     const std::pair<LoopScope *, LocalVariable *> &b) { return a.first < b.first; };
+    std::stable_sort(loopCaptures_.begin(), loopCaptures_.end(), byLoop);
+
+    // Outer loops are decided first, so an inner loop only moves its slots into an environment that stays
+    auto depth = [](const Scope *scope) {
+        size_t res = 0;
+        for (auto *iter = scope->Parent(); iter != nullptr; iter = iter->Parent()) {
+            res++;
+        }
+        return res;
+    };
+    std::stable_sort(capturingLoops_.begin(), capturingLoops_.end(),
+                     [&depth](const LoopScope *a, const LoopScope *b) { return depth(a) < depth(b); });
+
+    for (auto *loopScope : capturingLoops_) {
+        if (!loopScope->NeedLexEnv() || escapingLoops_.find(loopScope) != escapingLoops_.end()) {
+            continue;
+        }
+
+        ArenaVector<LocalVariable *> variables(Allocator()->Adapter());
+        auto [begin, end] = std::equal_range(loopCaptures_.begin(), loopCaptures_.end(),
+                                             std::pair<LoopScope *, LocalVariable *> {loopScope, nullptr}, byLoop);
+        for (auto iter = begin; iter != end; iter++) {
+            if (std::find(variables.begin(), variables.end(), iter->second) == variables.end()) {
+                variables.push_back(iter->second);
+            }
+        }
+        if (variables.size() != loopScope->LexicalSlots()) {
+            continue;
+        }
+
+        VariableScope *target = nullptr;
+        for (auto *iter = loopScope->Parent(); iter != nullptr; iter = iter->Parent()) {
+            if (iter->IsFunctionVariableScope()) {
+                if (iter->IsFunctionScope() || iter->IsGlobalScope() || iter->IsModuleScope()) {
+                    target = iter->AsVariableScope();
+                }
+                break;
+            }
+            if (iter->IsVariableScope() && iter->AsVariableScope()->NeedLexEnv()) {
+                target = iter->AsVariableScope();
+                break;
+            }
+        }
+        if (target == nullptr) {
+            continue;
+        }
+
+        std::sort(variables.begin(), variables.end(),
+                  [](const LocalVariable *a, const LocalVariable *b) { return a->LexIdx() < b->LexIdx(); });
+        for (auto *variable : variables) {
+            uint32_t slot = target->NextSlot();
+            variable->MoveLexEnvSlot(slot);
+            target->AddLexicalVarNameAndType(slot, variable->Declaration()->Name(),
+                static_cast<typename std::underlying_type<binder::DeclType>::type>(variable->Declaration()->Type()));
+        }
+        loopScope->ResetLexicalSlots();
+    }
+}
+
 void Binder::StoreAndCheckSpecialFunctionName(std::string &internalNameStr, std::string recordName)
 {
     if (program_->PatchFixHelper()) {
@@ -680,7 +830,7 @@ void Binder::ResolveReference(const ir::AstNode *parent, ir::AstNode *childNode)
             if (Program()->Extension() == ScriptExtension::JS) {
                 CheckPrivateDeclaration(childNode->AsPrivateIdentifier());
             } else if (Program()->Extension() == ScriptExtension::TS &&
-                       bindingFlags_ == ResolveBindingFlags::TS_AFTER_TRANSFORM) {
+                       !(bindingFlags_ & ResolveBindingFlags::TS_BEFORE_TRANSFORM)) {
                 CheckPrivateDeclaration(childNode->AsPrivateIdentifier());
             }
             break;
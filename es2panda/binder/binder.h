@@ -52,6 +52,10 @@ public:
           functionHashNames_(Allocator()->Adapter()),
           variableNames_(Allocator()->Adapter()),
           specialFuncNameIndexMap_(Allocator()->Adapter()),
+          capturingLoops_(Allocator()->Adapter()),
+          escapingLoops_(Allocator()->Adapter()),
+          loopCaptures_(Allocator()->Adapter()),
+          loopClosures_(Allocator()->Adapter()),
           extension_(extension)
     {
         if (extension_ == ScriptExtension::TS) {
@@ -209,6 +213,8 @@ private:
                           ir::Expression *right, ir::Statement *body);
     void BuildCatchClause(ir::CatchClause *catchClauseStmt);
     void LookupIdentReference(ir::Identifier *ident);
+    void RecordLoopCapture(const ScopeFindResult &res, const ir::Identifier *ident);
+    void HoistLoopLexicals();
     void ResolveReference(const ir::AstNode *parent, ir::AstNode *childNode);
     void ResolveReferences(const ir::AstNode *parent);
     void ValidateExportDecl(const ir::ExportNamedDeclaration *exportDecl);
@@ -231,6 +237,11 @@ private:
     ArenaSet<util::StringView> variableNames_;
     uint32_t globalIndexForSpecialFunc_ {0};
     ArenaUnorderedMap<std::string, std::string> specialFuncNameIndexMap_;
+    // Loops whose lexical variables are captured, in the order they were first seen, and what captures them
+    ArenaVector<LoopScope *> capturingLoops_;
+    ArenaUnorderedSet<const LoopScope *> escapingLoops_;
+    ArenaVector<std::pair<LoopScope *, LocalVariable *>> loopCaptures_;
+    ArenaVector<std::pair<LoopScope *, FunctionScope *>> loopClosures_;
     ResolveBindingFlags bindingFlags_ {ResolveBindingFlags::ALL};
     ScriptExtension extension_;
     bool inSendable_ {false};
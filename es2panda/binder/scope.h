@@ -433,6 +433,12 @@ public:
         return slotIndex_++;
     }
 
+    void ResetLexicalSlots()
+    {
+        slotIndex_ = 0;
+        lexicalVarNameAndTypes_.clear();
+    }
+
     uint32_t LexicalSlots() const
     {
         return slotIndex_;
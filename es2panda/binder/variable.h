@@ -148,6 +148,12 @@ public:
         vreg_ = slot;
     }
 
+    void MoveLexEnvSlot(uint32_t slot)
+    {
+        ASSERT(LexicalBound());
+        vreg_ = slot;
+    }
+
     compiler::VReg Vreg() const
     {
         return vreg_;
@@ -25,7 +25,9 @@
 #include <mem/arena_allocator.h>
 #include <mem/pool_manager.h>
 #include <protobufSnapshotGenerator.h>
+#include <util/arenaStatistics.h>
 #include <util/dumper.h>
+#include <util/functionCache.h>
 #include <util/helpers.h>
 
 namespace panda::es2panda::compiler {
@@ -45,8 +47,17 @@ void CompileFunctionJob::Run()
     FunctionEmitter funcEmitter(&allocator, &pg);
     funcEmitter.Generate(context_->PatchFixHelper());
 
+    if (context_->FunctionCache() != nullptr) {
+        context_->FunctionCache()->Record(scope_, *funcEmitter.Function(), !funcEmitter.LiteralBuffers().empty());
+    }
+
     context_->GetEmitter()->AddFunction(&funcEmitter, context_);
 
+    if (util::ArenaStatistics::IsEnabled()) {
+        util::ArenaStatistics::Record(context_->Binder()->Program()->SourceFile().Mutf8(),
+                                      util::ArenaStatistics::PHASE_FUNCTION, &allocator);
+    }
+
     for (auto *dependant : dependants_) {
         dependant->Signal();
     }
@@ -69,33 +80,54 @@ void CompileModuleRecordJob::Run()
 
 void CompileFileJob::Run()
 {
-    std::stringstream ss;
+    // The source is parsed in place from the mapped file, reading it into a buffer is only a fallback.
+    // Both have to stay alive until the compilation of the file is finished.
+    std::optional<os::mem::BytePtr> mappedSource;
     std::string buffer;
+    // The cached program has to outlive the compilation, its functions are moved into the new program
+    std::optional<ArenaAllocator> cacheAllocator;
+    util::ArenaProgramCachePtr cacheProgramInfo;
+    std::unique_ptr<util::FunctionCache> functionCache;
     if (!src_->fileName.empty()) {
-        if (!util::Helpers::ReadFileToBuffer(src_->fileName, ss)) {
-            return;
+        mappedSource = util::Helpers::MapFileToMemory(src_->fileName);
+        if (mappedSource.has_value()) {
+            src_->source = std::string_view(reinterpret_cast<const char *>(mappedSource->Get()),
+                                            mappedSource->GetSize());
+        } else {
+            std::stringstream ss;
+            if (!util::Helpers::ReadFileToBuffer(src_->fileName, ss)) {
+                return;
+            }
+            buffer = ss.str();
+            src_->source = buffer;
         }
-        buffer = ss.str();
-        src_->source = buffer;
 
         auto cacheFileIter = options_->cacheFiles.find(src_->fileName);
         if (cacheFileIter != options_->cacheFiles.end()) {
-            src_->hash = GetHash32String(reinterpret_cast<const uint8_t *>(buffer.c_str()));
+            src_->hash = GetHash32(reinterpret_cast<const uint8_t *>(src_->source.data()), src_->source.size());
 
-            ArenaAllocator allocator(SpaceType::SPACE_TYPE_COMPILER, nullptr, true);
-            auto *cacheProgramInfo = proto::ProtobufSnapshotGenerator::GetCacheContext(cacheFileIter->second,
-                &allocator);
+            cacheAllocator.emplace(SpaceType::SPACE_TYPE_COMPILER, nullptr, true);
+            cacheProgramInfo.reset(proto::ProtobufSnapshotGenerator::GetCacheContext(cacheFileIter->second,
+                &cacheAllocator.value()));
+            util::ArenaStatistics::Record(src_->fileName, util::ArenaStatistics::PHASE_CACHE, &cacheAllocator.value());
 
             if (cacheProgramInfo != nullptr && cacheProgramInfo->hashCode == src_->hash) {
-                std::unique_lock<std::mutex> lock(global_m_);
-                auto *cache = allocator_->New<util::ProgramCache>(src_->hash, std::move(cacheProgramInfo->program));
-                progsInfo_.insert({src_->fileName, cache});
+                util::ProgramCache *cache = nullptr;
+                {
+                    std::unique_lock<std::mutex> lock(global_m_);
+                    cache = allocator_->New<util::ProgramCache>(src_->hash, std::move(cacheProgramInfo->program));
+                }
+                InsertProgram(cache);
                 return;
             }
+
+            // The file has changed, unchanged functions can still be taken over from the cached program
+            functionCache = std::make_unique<util::FunctionCache>(cacheProgramInfo.get());
         }
     }
 
     es2panda::Compiler compiler(src_->scriptExtension, options_->functionThreadCount);
+    compiler.AddFunctionCache(functionCache.get());
     auto *prog = compiler.CompileFile(*options_, src_, symbolTable_);
     if (prog == nullptr) {
         return;
@@ -105,11 +137,28 @@ void CompileFileJob::Run()
         util::Helpers::OptimizeProgram(prog, src_->fileName);
     }
 
+    util::ProgramCache *cache = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(global_m_);
+        cache = allocator_->New<util::ProgramCache>(src_->hash, std::move(*prog), true);
+    }
+    delete prog;
+    if (functionCache != nullptr) {
+        cache->functionKeys = functionCache->TakeFunctionKeys();
+    }
+    InsertProgram(cache);
+}
+
+void CompileFileJob::InsertProgram(util::ProgramCache *cache)
+{
     {
         std::unique_lock<std::mutex> lock(global_m_);
-        auto *cache = allocator_->New<util::ProgramCache>(src_->hash, std::move(*prog), true);
         progsInfo_.insert({src_->fileName, cache});
     }
+
+    if (emitProgram_) {
+        emitProgram_(src_->fileName, cache);
+    }
 }
 
 void CompileFuncQueue::Schedule()
@@ -117,8 +166,18 @@ void CompileFuncQueue::Schedule()
     ASSERT(jobsCount_ == 0);
     std::unique_lock<std::mutex> lock(m_);
     const auto &functions = context_->Binder()->Functions();
+    auto *functionCache = context_->FunctionCache();
 
     for (auto *function : functions) {
+        if (functionCache != nullptr) {
+            std::set<std::string> strings;
+            auto cachedFunction = functionCache->TakeFunction(function, strings);
+            if (cachedFunction.has_value()) {
+                context_->GetEmitter()->AddCachedFunction(std::move(*cachedFunction), strings);
+                continue;
+            }
+        }
+
         auto *funcJob = new CompileFunctionJob(context_);
         funcJob->SetFunctionScope(function);
         jobs_.push_back(funcJob);
@@ -141,7 +200,7 @@ void CompileFileQueue::Schedule()
     std::unique_lock<std::mutex> lock(m_);
 
     for (auto &input: options_->sourceFiles) {
-        auto *fileJob = new CompileFileJob(&input, options_, progsInfo_, symbolTable_, allocator_);
+        auto *fileJob = new CompileFileJob(&input, options_, progsInfo_, symbolTable_, allocator_, emitProgram_);
         jobs_.push_back(fileJob);
         jobsCount_++;
     }
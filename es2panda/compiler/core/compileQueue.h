@@ -74,8 +74,10 @@ class CompileFileJob : public util::WorkerJob {
 public:
     explicit CompileFileJob(es2panda::SourceFile *src, es2panda::CompilerOptions *options,
                             std::map<std::string, panda::es2panda::util::ProgramCache*> &progsInfo,
-                            util::SymbolTable *symbolTable, panda::ArenaAllocator *allocator)
-        : src_(src), options_(options), progsInfo_(progsInfo), symbolTable_(symbolTable), allocator_(allocator) {};
+                            util::SymbolTable *symbolTable, panda::ArenaAllocator *allocator,
+                            const util::EmitProgramCallback &emitProgram)
+        : src_(src), options_(options), progsInfo_(progsInfo), symbolTable_(symbolTable), allocator_(allocator),
+        emitProgram_(emitProgram) {};
     NO_COPY_SEMANTIC(CompileFileJob);
     NO_MOVE_SEMANTIC(CompileFileJob);
     ~CompileFileJob() override = default;
@@ -83,12 +85,15 @@ public:
     void Run() override;
 
 private:
+    void InsertProgram(util::ProgramCache *cache);
+
     static std::mutex global_m_;
     es2panda::SourceFile *src_;
     es2panda::CompilerOptions *options_;
     std::map<std::string, panda::es2panda::util::ProgramCache*> &progsInfo_;
     util::SymbolTable *symbolTable_;
     panda::ArenaAllocator *allocator_;
+    const util::EmitProgramCallback &emitProgram_;
 };
 
 class CompileFuncQueue : public util::WorkerQueue {
@@ -110,9 +115,10 @@ class CompileFileQueue : public util::WorkerQueue {
 public:
     explicit CompileFileQueue(size_t threadCount, es2panda::CompilerOptions *options,
                               std::map<std::string, panda::es2panda::util::ProgramCache*> &progsInfo,
-                              util::SymbolTable *symbolTable, panda::ArenaAllocator *allocator)
+                              util::SymbolTable *symbolTable, panda::ArenaAllocator *allocator,
+                              const util::EmitProgramCallback &emitProgram)
         : util::WorkerQueue(threadCount), options_(options), progsInfo_(progsInfo),
-        symbolTable_(symbolTable), allocator_(allocator) {}
+        symbolTable_(symbolTable), allocator_(allocator), emitProgram_(emitProgram) {}
 
     NO_COPY_SEMANTIC(CompileFileQueue);
     NO_MOVE_SEMANTIC(CompileFileQueue);
@@ -125,6 +131,7 @@ private:
     std::map<std::string, panda::es2panda::util::ProgramCache*> &progsInfo_;
     util::SymbolTable *symbolTable_;
     panda::ArenaAllocator *allocator_;
+    const util::EmitProgramCallback &emitProgram_;
 };
 
 }  // namespace panda::es2panda::compiler
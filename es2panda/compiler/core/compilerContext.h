@@ -31,6 +31,10 @@ namespace panda::es2panda::binder {
 class Binder;
 }  // namespace panda::es2panda::binder
 
+namespace panda::es2panda::util {
+class FunctionCache;
+}  // namespace panda::es2panda::util
+
 namespace panda::es2panda::extractor {
 class TypeRecorder;
 class TypeExtractor;
@@ -131,6 +135,16 @@ public:
     void SetTypeRecorder(extractor::TypeRecorder *recorder);
     void SetTypeExtractor(extractor::TypeExtractor *extractor);
 
+    util::FunctionCache *FunctionCache() const
+    {
+        return functionCache_;
+    }
+
+    void SetFunctionCache(util::FunctionCache *functionCache)
+    {
+        functionCache_ = functionCache;
+    }
+
     bool IsJsonInputFile() const
     {
         return isJsonInputFile_;
@@ -160,6 +174,7 @@ private:
     std::string pkgName_;
     util::StringView recordName_;
     util::PatchFix *patchFixHelper_ {nullptr};
+    util::FunctionCache *functionCache_ {nullptr};
     std::unique_ptr<Emitter> emitter_;
 };
 
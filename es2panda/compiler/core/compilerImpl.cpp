@@ -22,8 +22,10 @@
 #include <es2panda.h>
 #include <parser/program/program.h>
 #include <typescript/checker.h>
+#include <util/arenaStatistics.h>
 
 #include <iostream>
+#include <sstream>
 #include <thread>
 
 namespace panda::es2panda::compiler {
@@ -36,6 +38,18 @@ CompilerImpl::~CompilerImpl()
     }
 }
 
+static std::string FunctionCacheFingerprint(const parser::Program *program, const es2panda::CompilerOptions &options,
+    const std::string &debugInfoSourceFile, const std::string &pkgName)
+{
+    std::stringstream ss;
+    ss << options.isDebug << options.mergeAbc << options.recordSource << options.useDefineSemantic
+       << options.hoistLoopLexicals << ":"
+       << options.optLevel << ":" << options.targetApiVersion << ":" << static_cast<int>(program->Extension()) << ":"
+       << static_cast<int>(program->Kind()) << ":" << debugInfoSourceFile << ":" << pkgName << ":"
+       << program->RecordName().Mutf8();
+    return ss.str();
+}
+
 panda::pandasm::Program *CompilerImpl::Compile(parser::Program *program, const es2panda::CompilerOptions &options,
     const std::string &debugInfoSourceFile, const std::string &pkgName)
 {
@@ -56,6 +70,14 @@ panda::pandasm::Program *CompilerImpl::Compile(parser::Program *program, const e
         context.SetTypeExtractor(extractor_.get());
     }
 
+    // Type annotations and patch symbols are generated per file, functions of such programs are always recompiled
+    if (functionCache_ != nullptr && patchFixHelper_ == nullptr && !isTypeExtractorEnabled &&
+        !options.isDebuggerEvaluateExpressionMode) {
+        functionCache_->SetOptionsFingerprint(FunctionCacheFingerprint(program, options, debugInfoSourceFile, pkgName));
+        functionCache_->ComputeKeys(program->Binder());
+        context.SetFunctionCache(functionCache_);
+    }
+
     queue_ = new CompileFuncQueue(threadCount_, &context);
     queue_->Schedule();
 
@@ -77,7 +99,12 @@ panda::pandasm::Program *CompilerImpl::Compile(parser::Program *program, const e
             std::string(program->RecordName()));
     }
 
-    return context.GetEmitter()->Finalize(options.dumpDebugInfo, patchFixHelper_);
+    auto *prog = context.GetEmitter()->Finalize(options.dumpDebugInfo, patchFixHelper_);
+    if (util::ArenaStatistics::IsEnabled()) {
+        util::ArenaStatistics::Record(program->SourceFile().Mutf8(), util::ArenaStatistics::PHASE_COMPILE,
+                                      &localAllocator);
+    }
+    return prog;
 }
 
 void CompilerImpl::DumpAsm(const panda::pandasm::Program *prog)
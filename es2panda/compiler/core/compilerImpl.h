@@ -21,6 +21,7 @@
 #include <mem/arena_allocator.h>
 #include <os/thread.h>
 #include <typescript/extractor/typeExtractor.h>
+#include <util/functionCache.h>
 #include <util/patchFix.h>
 
 #include <string>
@@ -52,10 +53,16 @@ public:
         patchFixHelper_ = patchFixHelper;
     }
 
+    void AddFunctionCache(util::FunctionCache *functionCache)
+    {
+        functionCache_ = functionCache;
+    }
+
 private:
     size_t threadCount_ {0};
     CompileFuncQueue *queue_ {nullptr};
     util::PatchFix *patchFixHelper_ {nullptr};
+    util::FunctionCache *functionCache_ {nullptr};
     std::unique_ptr<extractor::TypeExtractor> extractor_ {};
 };
 }  // namespace panda::es2panda::compiler
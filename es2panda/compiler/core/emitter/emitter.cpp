@@ -442,6 +442,15 @@ void Emitter::AddFunction(FunctionEmitter *func, CompilerContext *context)
     prog_->function_table.emplace(function->name, std::move(*function));
 }
 
+void Emitter::AddCachedFunction(panda::pandasm::Function &&function, const std::set<std::string> &strings)
+{
+    std::lock_guard<std::mutex> lock(m_);
+
+    prog_->strings.insert(strings.begin(), strings.end());
+    std::string name = function.name;
+    prog_->function_table.emplace(std::move(name), std::move(function));
+}
+
 void Emitter::AddSourceTextModuleRecord(ModuleRecordEmitter *module, CompilerContext *context)
 {
     std::lock_guard<std::mutex> lock(m_);
@@ -27,6 +27,7 @@
 
 #include <list>
 #include <mutex>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -109,6 +110,7 @@ public:
     NO_MOVE_SEMANTIC(Emitter);
 
     void AddFunction(FunctionEmitter *func, CompilerContext *context);
+    void AddCachedFunction(panda::pandasm::Function &&function, const std::set<std::string> &strings);
     void AddSourceTextModuleRecord(ModuleRecordEmitter *module, CompilerContext *context);
     void FillTypeInfoRecord(CompilerContext *context, bool typeFlag, int64_t typeSummaryIndex,
         const std::string &recordName) const;
@@ -550,8 +550,9 @@ void PandaGen::TryLoadGlobalByName(const ir::AstNode *node, const util::StringVi
     if (isDebuggerEvaluateExpressionMode()) {
         LoadObjByNameViaDebugger(node, name, true);
     } else {
-        int64_t typeIndex = extractor::TypeExtractor::GetBuiltinTypeIndex(name);
-        if (context_->IsTypeExtractorEnabled() && typeIndex != extractor::TypeRecorder::PRIMITIVETYPE_ANY) {
+        int64_t typeIndex = context_->IsTypeExtractorEnabled() ?
+            extractor::TypeExtractor::GetBuiltinTypeIndex(name) : extractor::TypeRecorder::PRIMITIVETYPE_ANY;
+        if (typeIndex != extractor::TypeRecorder::PRIMITIVETYPE_ANY) {
             ra_.EmitWithType<Tryldglobalbyname>(node, typeIndex, 0, name);
         } else {
             ra_.Emit<Tryldglobalbyname>(node, 0, name);
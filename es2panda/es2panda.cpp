@@ -23,6 +23,7 @@
 #include <parser/program/program.h>
 #include <parser/transformer/transformer.h>
 #include <typescript/checker.h>
+#include <util/arenaStatistics.h>
 #include <util/helpers.h>
 
 #include <iostream>
@@ -77,7 +78,6 @@ panda::pandasm::Program *Compiler::Compile(const SourceFile &input, const Compil
 {
     /* TODO(dbatyai): pass string view */
     std::string fname(input.fileName);
-    std::string src(input.source);
     std::string rname(input.recordName);
     std::string sourcefile(input.sourcefile);
     std::string pkgName(input.pkgName);
@@ -85,7 +85,7 @@ panda::pandasm::Program *Compiler::Compile(const SourceFile &input, const Compil
     auto *patchFixHelper = InitPatchFixHelper(input, options, symbolTable);
 
     if (fname.substr(fname.find_last_of(".") + 1) == "json") {
-        return CreateJsonContentProgram(src, rname, patchFixHelper);
+        return CreateJsonContentProgram(std::string(input.source), rname, patchFixHelper);
     }
 
     try {
@@ -104,11 +104,19 @@ panda::pandasm::Program *Compiler::Compile(const SourceFile &input, const Compil
             ArenaAllocator localAllocator(SpaceType::SPACE_TYPE_COMPILER, nullptr, true);
             auto checker = std::make_unique<checker::Checker>(&localAllocator, ast.Binder());
             checker->StartChecker();
+            util::ArenaStatistics::Record(fname, util::ArenaStatistics::PHASE_CHECK, &localAllocator);
         }
 
         if (ast.Extension() == ScriptExtension::TS) {
-            transformer_->Transform(&ast);
-            ast.Binder()->IdentifierAnalysis(binder::ResolveBindingFlags::TS_AFTER_TRANSFORM);
+            if (options.dumpTsTransformStatus) {
+                std::cout << (ast.TSTransformRequired() ? "TS transform: applied, bound twice" :
+                                                          "TS transform: skipped, bound once") << std::endl;
+            }
+            // Without anything to rewrite, the program has already been bound completely by the parser
+            if (ast.TSTransformRequired()) {
+                transformer_->Transform(&ast);
+                ast.Binder()->IdentifierAnalysis(binder::ResolveBindingFlags::TS_AFTER_TRANSFORM);
+            }
             if (options.dumpTransformedAst) {
                 std::cout << ast.Dump() << std::endl;
             }
@@ -124,6 +132,7 @@ panda::pandasm::Program *Compiler::Compile(const SourceFile &input, const Compil
         std::string debugInfoSourceFile = options.debugInfoSourceFile.empty() ?
                                           sourcefile : options.debugInfoSourceFile;
         auto *prog = compiler_->Compile(&ast, options, debugInfoSourceFile, pkgName);
+        util::ArenaStatistics::Record(fname, util::ArenaStatistics::PHASE_PARSE, ast.Allocator());
 
         CleanPatchFixHelper(patchFixHelper);
         return prog;
@@ -167,13 +176,19 @@ void Compiler::CleanPatchFixHelper(const util::PatchFix *patchFixHelper)
     }
 }
 
+void Compiler::AddFunctionCache(util::FunctionCache *functionCache)
+{
+    compiler_->AddFunctionCache(functionCache);
+}
+
 void Compiler::DumpAsm(const panda::pandasm::Program *prog)
 {
     compiler::CompilerImpl::DumpAsm(prog);
 }
 
 int Compiler::CompileFiles(CompilerOptions &options,
-    std::map<std::string, panda::es2panda::util::ProgramCache*> &progsInfo, panda::ArenaAllocator *allocator)
+    std::map<std::string, panda::es2panda::util::ProgramCache*> &progsInfo, panda::ArenaAllocator *allocator,
+    const util::EmitProgramCallback &emitProgram)
 {
     util::SymbolTable *symbolTable = nullptr;
     if (!options.patchFixOptions.symbolTable.empty() || !options.patchFixOptions.dumpSymbolTable.empty()) {
@@ -186,7 +201,8 @@ int Compiler::CompileFiles(CompilerOptions &options,
     }
 
     bool failed = false;
-    auto queue = new compiler::CompileFileQueue(options.fileThreadCount, &options, progsInfo, symbolTable, allocator);
+    auto queue = new compiler::CompileFileQueue(options.fileThreadCount, &options, progsInfo, symbolTable, allocator,
+        emitProgram);
 
     try {
         queue->Schedule();
@@ -41,6 +41,10 @@ namespace compiler {
 class CompilerImpl;
 }  // namespace compiler
 
+namespace util {
+class FunctionCache;
+}  // namespace util
+
 enum class ScriptExtension {
     JS,
     TS,
@@ -79,6 +83,8 @@ struct CompilerOptions {
     bool dumpAst {false};
     bool dumpTransformedAst {false};
     bool checkTransformedAstStructure {false};
+    bool forceTsTransform {false};
+    bool dumpTsTransformStatus {false};
     bool dumpAsm {false};
     bool dumpDebugInfo {false};
     bool parseOnly {false};
@@ -87,6 +93,7 @@ struct CompilerOptions {
     bool isDebuggerEvaluateExpressionMode {false};
     bool mergeAbc {false};
     bool useDefineSemantic {false};
+    bool hoistLoopLexicals {false};
     bool typeExtractor {false};
     bool typeDtsBuiltin {false};
     bool recordSource {false};
@@ -184,9 +191,11 @@ public:
     panda::pandasm::Program *Compile(const SourceFile &input, const CompilerOptions &options,
         util::SymbolTable *symbolTable = nullptr);
     panda::pandasm::Program *CompileFile(const CompilerOptions &options, SourceFile *src, util::SymbolTable *symbolTable);
+    void AddFunctionCache(util::FunctionCache *functionCache);
 
     static int CompileFiles(CompilerOptions &options,
-        std::map<std::string, panda::es2panda::util::ProgramCache*> &progsInfo, panda::ArenaAllocator *allocator);
+        std::map<std::string, panda::es2panda::util::ProgramCache*> &progsInfo, panda::ArenaAllocator *allocator,
+        const util::EmitProgramCallback &emitProgram = nullptr);
 
     inline panda::pandasm::Program *Compile(const SourceFile &input)
     {
@@ -1684,6 +1684,7 @@ ir::Expression *ParserImpl::ParsePostPrimaryExpression(ir::Expression *primaryEx
                     lexer_->NextToken();
 
                     if (isPrivate) {
+                        program_.SetTSTransformRequired();
                         property = AllocNode<ir::TSPrivateIdentifier>(identNode, nullptr, nullptr);
                         property->SetRange({memberStart, identNode->End()});
                     } else {
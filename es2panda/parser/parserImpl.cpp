@@ -14,6 +14,7 @@
  */
 
 #include "parserImpl.h"
+#include <algorithm>
 #include <functional>
 
 #include <binder/scope.h>
@@ -115,7 +116,7 @@ namespace panda::es2panda::parser {
 
 ParserImpl::ParserImpl(ScriptExtension extension) : program_(extension), context_(&program_) {}
 
-std::unique_ptr<lexer::Lexer> ParserImpl::InitLexer(const std::string &fileName, const std::string &source)
+std::unique_ptr<lexer::Lexer> ParserImpl::InitLexer(const std::string &fileName, std::string_view source)
 {
     bool isDtsFile = false;
     if (Extension() == ScriptExtension::TS) {
@@ -133,16 +134,21 @@ Program ParserImpl::Parse(const SourceFile &sourceFile, const CompilerOptions &o
     program_.SetKind(sourceFile.scriptKind);
     program_.SetRecordName(sourceFile.recordName);
     program_.SetDebug(options.isDebug);
+    program_.SetHoistLoopLexicals(options.hoistLoopLexicals);
     program_.SetTargetApiVersion(options.targetApiVersion);
     program_.SetShared(sourceFile.isSharedModule);
     if (Extension() == ScriptExtension::TS) {
         program_.SetDefineSemantic(options.useDefineSemantic);
+        // The checker and the type extractor consume the TS variables resolved by the binding before transform
+        if (options.enableTypeCheck || options.typeExtractor || options.forceTsTransform) {
+            program_.SetTSTransformRequired();
+        }
     }
 
     /*
      * In order to make the lexer's memory alive, the return value 'lexer' can not be omitted.
      */
-    auto lexer = InitLexer(sourceFile.fileName, std::string {sourceFile.source});
+    auto lexer = InitLexer(sourceFile.fileName, sourceFile.source);
     switch (sourceFile.scriptKind) {
         case ScriptKind::SCRIPT: {
             ParseScript();
@@ -161,7 +167,7 @@ Program ParserImpl::Parse(const SourceFile &sourceFile, const CompilerOptions &o
         }
     }
     binder::ResolveBindingFlags bindFlags = binder::ResolveBindingFlags::ALL;
-    if (Extension() == ScriptExtension::TS) {
+    if (Extension() == ScriptExtension::TS && program_.TSTransformRequired()) {
         bindFlags = binder::ResolveBindingFlags::TS_BEFORE_TRANSFORM;
     }
     Binder()->IdentifierAnalysis(bindFlags);
@@ -2616,6 +2622,7 @@ ir::MethodDefinition *ParserImpl::ParseClassMethod(ClassElmentDescriptor *desc,
     ir::MethodDefinition *method = nullptr;
 
     if (desc->isPrivateIdent && Extension() == ScriptExtension::TS && program_.TargetApiVersion() <= 10) {
+        program_.SetTSTransformRequired();
         ir::Expression *privateId = AllocNode<ir::TSPrivateIdentifier>(propName, nullptr, nullptr);
         auto privateIdStart = lexer::SourcePosition(propName->Start().index - 1, propName->Start().line);
         privateId->SetRange({privateIdStart, propName->End()});
@@ -2686,6 +2693,7 @@ ir::Statement *ParserImpl::ParseClassProperty(ClassElmentDescriptor *desc,
     }
 
     if (Extension() == ScriptExtension::TS && desc->isPrivateIdent && program_.TargetApiVersion() <= 10) {
+        program_.SetTSTransformRequired();
         auto *privateId = AllocNode<ir::TSPrivateIdentifier>(propName, value, typeAnnotation);
         auto privateIdStart = lexer::SourcePosition(propName->Start().index - 1, propName->Start().line);
         privateId->SetRange({privateIdStart, propName->End()});
@@ -3071,6 +3079,29 @@ ir::Identifier *ParserImpl::SetIdentNodeInClassDefinition(bool isDeclare, binder
     return identNode;
 }
 
+// Fields are moved out of the class body by the transformer, decorators and parameter properties are expanded by it.
+// Methods, accessors and static blocks are compiled as they are.
+static bool ClassRequiresTSTransform(const ArenaVector<ir::Statement *> &properties, const ir::MethodDefinition *ctor)
+{
+    if (ctor->HasParamDecorators()) {
+        return true;
+    }
+
+    const auto &ctorParams = ctor->Value()->Function()->Params();
+    if (std::any_of(ctorParams.begin(), ctorParams.end(),
+                    [](const ir::Expression *param) { return param->IsTSParameterProperty(); })) {
+        return true;
+    }
+
+    return std::any_of(properties.begin(), properties.end(), [](const ir::Statement *property) {
+        if (property->IsClassProperty()) {
+            return true;
+        }
+        return property->IsMethodDefinition() &&
+               (property->AsMethodDefinition()->HasDecorators() || property->AsMethodDefinition()->HasParamDecorators());
+    });
+}
+
 ir::ClassDefinition *ParserImpl::ParseClassDefinition(bool isDeclaration, bool idRequired, bool isDeclare,
                                                       bool isAbstract)
 {
@@ -3183,6 +3214,9 @@ ir::ClassDefinition *ParserImpl::ParseClassDefinition(bool isDeclaration, bool i
 
     ValidateClassConstructor(ctor, properties, isDeclare, hasConstructorFuncBody, hasSuperClass, isExtendsFromNull);
 
+    if (!isDeclare && ClassRequiresTSTransform(properties, ctor)) {
+        program_.SetTSTransformRequired();
+    }
     auto *classDefinition = AllocNode<ir::ClassDefinition>(
         classCtx.GetScope(), identNode, typeParamDecl, superTypeParams, std::move(implements), ctor, staticInitializer,
         instanceInitializer, superClass, std::move(properties), std::move(indexSignatures), isDeclare, isAbstract);
@@ -3475,6 +3509,9 @@ ir::TSEnumDeclaration *ParserImpl::ParseEnumMembers(ir::Identifier *key, const l
         }
     }
 
+    if (!isDeclare) {
+        program_.SetTSTransformRequired();
+    }
     auto *enumDeclaration = AllocNode<ir::TSEnumDeclaration>(
         Binder()->GetScope()->AsTSEnumScope(), key, std::move(members), isExport, isDeclare, isConst);
     enumDeclaration->SetRange({enumStart, lexer_->GetToken().End()});
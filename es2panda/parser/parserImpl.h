@@ -223,7 +223,7 @@ private:
         return ret;
     }
 
-    [[nodiscard]] std::unique_ptr<lexer::Lexer> InitLexer(const std::string &fileName, const std::string &source);
+    [[nodiscard]] std::unique_ptr<lexer::Lexer> InitLexer(const std::string &fileName, std::string_view source);
     void ParseScript();
     void ParseModule();
 
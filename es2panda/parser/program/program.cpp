@@ -23,7 +23,6 @@ namespace panda::es2panda::parser {
 Program::Program(ScriptExtension extension)
     : allocator_(std::make_unique<ArenaAllocator>(SpaceType::SPACE_TYPE_COMPILER, nullptr, true)),
       binder_(allocator_->New<binder::Binder>(this, extension)),
-      sourceCode_(Allocator()),
       sourceFile_(Allocator()),
       extension_(extension)
 {
@@ -48,7 +47,8 @@ Program::Program(Program &&other)
       isDebug_(other.isDebug_),
       targetApiVersion_(other.targetApiVersion_),
       useDefineSemantic_(other.useDefineSemantic_),
-      isShared_(other.isShared_)
+      isShared_(other.isShared_),
+      tsTransformRequired_(other.tsTransformRequired_)
 {
     other.binder_ = nullptr;
     other.ast_ = nullptr;
@@ -70,6 +70,7 @@ Program &Program::operator=(Program &&other)
     targetApiVersion_ = other.targetApiVersion_;
     useDefineSemantic_ = other.useDefineSemantic_;
     isShared_ = other.isShared_;
+    tsTransformRequired_ = other.tsTransformRequired_;
 
     other.ast_ = nullptr;
 
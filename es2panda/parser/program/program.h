@@ -87,7 +87,7 @@ public:
 
     util::StringView SourceCode() const
     {
-        return sourceCode_.View();
+        return sourceCode_;
     }
 
     util::StringView SourceFile() const
@@ -125,9 +125,10 @@ public:
         ast_ = ast;
     }
 
-    void SetSource(const std::string &sourceCode, const std::string &sourceFile, bool isDtsFile)
+    /* The source text is not copied, the caller keeps it alive as long as the program is used */
+    void SetSource(std::string_view sourceCode, const std::string &sourceFile, bool isDtsFile)
     {
-        sourceCode_ = util::UString(sourceCode, Allocator());
+        sourceCode_ = util::StringView(sourceCode);
         sourceFile_ = util::UString(sourceFile, Allocator());
         lineIndex_ = lexer::LineIndex(SourceCode());
         isDtsFile_ = isDtsFile;
@@ -195,6 +196,16 @@ public:
         useDefineSemantic_ = useDefineSemantic;
     }
 
+    bool HoistLoopLexicals() const
+    {
+        return hoistLoopLexicals_;
+    }
+
+    void SetHoistLoopLexicals(bool hoistLoopLexicals)
+    {
+        hoistLoopLexicals_ = hoistLoopLexicals;
+    }
+
     void SetShared(bool isShared)
     {
         isShared_ = isShared;
@@ -204,6 +215,16 @@ public:
     {
         return isShared_;
     }
+
+    bool TSTransformRequired() const
+    {
+        return tsTransformRequired_;
+    }
+
+    void SetTSTransformRequired()
+    {
+        tsTransformRequired_ = true;
+    }
     std::string Dump() const;
     void SetKind(ScriptKind kind);
 
@@ -211,7 +232,7 @@ private:
     std::unique_ptr<ArenaAllocator> allocator_ {};
     binder::Binder *binder_ {};
     ir::BlockStatement *ast_ {};
-    util::UString sourceCode_ {};
+    util::StringView sourceCode_ {};
     util::UString sourceFile_ {};
     util::UString recordName_ {};
     util::UString formatedRecordName_ {};
@@ -226,7 +247,10 @@ private:
     bool isDebug_ {false};
     int targetApiVersion_ {0};
     bool useDefineSemantic_ {true};
+    bool hoistLoopLexicals_ {false};
     bool isShared_ {false};
+    // Set when the TS transformer has something to rewrite, otherwise the binder resolves the program only once
+    bool tsTransformRequired_ {false};
 };
 
 }  // namespace panda::es2panda::parser
@@ -373,6 +373,9 @@ ir::TSModuleDeclaration *ParserImpl::ParseTsAmbientExternalModuleDeclaration(con
         ThrowSyntaxError("';' expected");
     }
 
+    if (!isDeclare) {
+        program_.SetTSTransformRequired();
+    }
     auto *moduleDecl = AllocNode<ir::TSModuleDeclaration>(localCtx.GetScope(), name, body, isDeclare, isGlobal);
     moduleDecl->SetRange({startLoc, lexer_->GetToken().End()});
     localCtx.GetScope()->BindNode(moduleDecl);
@@ -448,6 +451,10 @@ ir::TSModuleDeclaration *ParserImpl::ParseTsModuleOrNamespaceDelaration(const le
 
     context_.Status() = savedStatus;
 
+    // Namespaces without values are left to the compiler as they are
+    if (isInstantiated) {
+        program_.SetTSTransformRequired();
+    }
     auto *moduleDecl = AllocNode<ir::TSModuleDeclaration>(localCtx.GetScope(), identNode, body,
                                                           isDeclare, false, isInstantiated);
     moduleDecl->SetRange({startLoc, lexer_->GetToken().End()});
@@ -494,7 +501,11 @@ ir::TSImportEqualsDeclaration *ParserImpl::ParseTsImportEqualsDeclaration(const
         }
     }
 
-    auto *importEqualsDecl = AllocNode<ir::TSImportEqualsDeclaration>(id, ParseModuleReference(), isExport);
+    auto *moduleReference = ParseModuleReference();
+    if (!moduleReference->IsTSExternalModuleReference()) {
+        program_.SetTSTransformRequired();
+    }
+    auto *importEqualsDecl = AllocNode<ir::TSImportEqualsDeclaration>(id, moduleReference, isExport);
     importEqualsDecl->SetRange({startLoc, lexer_->GetToken().End()});
 
     ConsumeSemicolon(importEqualsDecl);
@@ -677,6 +688,7 @@ ir::ClassDeclaration *ParserImpl::ParseClassDeclaration(bool idRequired, ArenaVe
 
     if (!decorators.empty()) {
         classDefinition->SetClassDecoratorPresent();
+        program_.SetTSTransformRequired();
     }
 
     auto location = classDefinition->Ident() ? classDefinition->Ident()->Start() : startLoc;
@@ -2487,6 +2499,10 @@ ir::ExportDefaultDeclaration *ParserImpl::ParseExportDefaultDeclaration(const le
     }
 
     lexer::SourcePosition endLoc = declNode->End();
+    // An exported name may refer to a type only, the transformer drops such an export
+    if (declNode->IsIdentifier()) {
+        program_.SetTSTransformRequired();
+    }
     auto *exportDeclaration = AllocNode<ir::ExportDefaultDeclaration>(declNode, isExportEquals);
     exportDeclaration->SetRange({startLoc, endLoc});
 
@@ -3015,7 +3031,11 @@ ir::AstNode *ParserImpl::ParseImportDefaultSpecifier(ArenaVector<ir::AstNode *>
             var->AsImportEqualsVariable()->SetScope(scope);
         }
 
-        auto *importEqualsDecl = AllocNode<ir::TSImportEqualsDeclaration>(local, ParseModuleReference(), false);
+        auto *moduleReference = ParseModuleReference();
+        if (!moduleReference->IsTSExternalModuleReference()) {
+            program_.SetTSTransformRequired();
+        }
+        auto *importEqualsDecl = AllocNode<ir::TSImportEqualsDeclaration>(local, moduleReference, false);
 
         return importEqualsDecl;
     }
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Loop variables only captured by closures called right away share one slot of the enclosing environment
+let sum = 0;
+for (let i = 0; i < 5; i++) {
+    let k = i * 2;
+    sum += (() => k + i)();
+}
+print(sum);
+
+let results = [];
+for (let i = 0; i < 3; i++) {
+    let label = "item" + i;
+    results.push((() => label + ":" + i)());
+}
+print(results.join(","));
+
+// A read before the declaration needs a fresh hole in every iteration
+for (let i = 0; i < 2; i++) {
+    try {
+        (() => late)();
+    } catch (e) {
+        print(e instanceof ReferenceError);
+    }
+    let late = i;
+    print((() => late)());
+}
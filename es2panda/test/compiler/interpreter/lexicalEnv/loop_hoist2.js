@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The outer loop escapes and keeps an environment per iteration, the inner loop is hoisted into it
+let fns = [];
+for (let i = 0; i < 3; i++) {
+    fns.push(() => i);
+    let inner = 0;
+    for (let j = 0; j < 2; j++) {
+        let step = j + 1;
+        inner += (() => step * i)();
+    }
+    fns.push(() => inner);
+}
+print(fns.map(f => f()).join(","));
+
+// Both loops hoisted, the inner one into the function environment as well
+function nested() {
+    let total = 0;
+    for (let i = 1; i <= 2; i++) {
+        for (let j = 1; j <= 3; j++) {
+            let product = i * j;
+            total += (() => product + i)();
+        }
+    }
+    return total;
+}
+print(nested());
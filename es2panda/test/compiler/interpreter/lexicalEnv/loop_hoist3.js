@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// A static block has no environment to take the loop variables, the loop keeps its own
+class Counter {
+    static total = 0;
+    static {
+        for (let i = 1; i <= 3; i++) {
+            let v = i * 10;
+            Counter.total += (() => v)();
+        }
+    }
+}
+print(Counter.total);
+
+class Saved {
+    static fns = [];
+    static {
+        for (let i = 0; i < 3; i++) {
+            let v = i + 100;
+            Saved.fns.push((() => () => v)());
+        }
+    }
+}
+print(Saved.fns.map(f => f()).join(","));
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Closures that outlive the iteration need an environment per iteration
+let fns = [];
+for (let i = 0; i < 3; i++) {
+    let v = i * i;
+    (() => v)();
+    fns.push(() => v);
+}
+print(fns.map(f => f()).join(","));
+
+// A generator called right away still outlives the call
+let gens = [];
+for (let i = 0; i < 3; i++) {
+    let v = i + 1;
+    gens.push((function* () { yield v; })());
+}
+print(gens.map(g => g.next().value).join(","));
+
+// A named function expression can keep a reference to itself
+let saved = [];
+for (let i = 0; i < 3; i++) {
+    let v = i;
+    (function keep(first) {
+        if (first) {
+            saved.push(keep);
+        }
+        return v;
+    })(true);
+}
+print(saved.map(f => f(false)).join(","));
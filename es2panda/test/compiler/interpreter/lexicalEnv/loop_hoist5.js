@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// A static block has no environment to take the outer loop variables, so the outer loop keeps its own and the
+// inner loop moves its variables into it
+class Grid {
+    static cells = [];
+    static {
+        for (let i = 0; i < 3; i++) {
+            let row = i * 10;
+            for (let j = 0; j < 2; j++) {
+                let cell = row + j;
+                Grid.cells.push((() => cell + row)());
+            }
+        }
+    }
+}
+print(Grid.cells.join(","));
+
+// Same with a third loop level reading the variables of both loops around it
+class Cube {
+    static total = 0;
+    static {
+        for (let i = 1; i <= 2; i++) {
+            let a = i * 100;
+            for (let j = 1; j <= 2; j++) {
+                let b = a + j * 10;
+                for (let k = 1; k <= 2; k++) {
+                    let c = k;
+                    Cube.total += (() => a + b + c)();
+                }
+            }
+        }
+    }
+}
+print(Cube.total);
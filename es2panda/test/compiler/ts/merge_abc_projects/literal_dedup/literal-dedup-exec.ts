@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import { makeConfigA, makeListA, makeCounterA } from './literal-dedup-a';
+import { makeConfigB, makeListB, makeCounterB } from './literal-dedup-b';
+
+// Equal literals of both files may share one buffer, the created objects still have to be independent
+let configA = makeConfigA();
+let configB = makeConfigB();
+configA.retries = 5;
+print(configA.name, configA.retries, configB.name, configB.retries, configA.verbose === configB.verbose);
+
+let listA = makeListA();
+let listB = makeListB();
+listA.push(5);
+print(listA.length, listB.length, listB.join(","));
+
+let counterA = makeCounterA();
+let counterB = makeCounterB();
+counterA();
+print(counterA(), counterB());
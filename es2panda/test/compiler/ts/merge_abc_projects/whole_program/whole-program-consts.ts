@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Defined before the store of scale, reading it there has to fail
+function readScale(): number {
+    return scale;
+}
+
+let early = "unset";
+try {
+    early = String(readScale());
+} catch (e) {
+    early = e instanceof ReferenceError ? "tdz" : "other";
+}
+
+// Stored once with a constant, loads in functions created after the store may be folded
+export let scale = 3;
+
+// Stored twice, never folded
+export let label = "slow";
+label = "fast";
+
+// Nothing names it, so it is removed
+function unusedHelper(): number {
+    return scale * 100;
+}
+
+export function earlyRead(): string {
+    return early;
+}
+
+export function scaled(x: number): number {
+    return x * scale;
+}
+
+export function currentLabel(): string {
+    return label;
+}
+
+export function makeReader(): () => number {
+    return () => scale + 1;
+}
+
+export class Box {
+    value: number;
+
+    constructor(v: number) {
+        this.value = v * scale;
+    }
+
+    get doubled(): number {
+        return this.value * 2;
+    }
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import { earlyRead, scaled, currentLabel, makeReader, Box } from './whole-program-consts';
+import { greeting, shout } from './whole-program-lib-abc-input';
+
+print(earlyRead());
+print(scaled(2), currentLabel(), makeReader()());
+let box = new Box(2);
+print(box.value, box.doubled);
+print(greeting(), shout("hi"));
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compiled to an abc file first, the merged compilation takes it as an input and leaves it as it is
+export let greetingText = "hello";
+
+function unusedInLib(): number {
+    return 1;
+}
+
+export function greeting(): string {
+    return greetingText;
+}
+
+export function shout(s: string): string {
+    return s.toUpperCase() + "!";
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+abstract class Shape {
+    abstract area(): number;
+
+    describe(): string {
+        return `${this.constructor.name} ${this.area()}`;
+    }
+}
+
+class Unit extends Shape {
+    static create(): Unit {
+        return new Unit();
+    }
+
+    static {
+        print(Unit.create().describe());
+    }
+
+    constructor() {
+        super();
+    }
+
+    get twice(): number {
+        return this.area() * 2;
+    }
+
+    area(): number {
+        return 1;
+    }
+}
+
+print(new Unit().twice);
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+function counter(start: number): () => number {
+    let current: number = start;
+    return (): number => ++current;
+}
+
+function makeAdders(count: number): Array<(x: number) => number> {
+    const adders: Array<(x: number) => number> = [];
+    for (let i = 0; i < count; i++) {
+        adders.push((x: number): number => x + i);
+    }
+    return adders;
+}
+
+const next = counter(10);
+next();
+print(next(), makeAdders(3).map((add) => add(1)));
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+type Pair<T> = [T, T];
+
+interface Shape {
+    area(): number;
+}
+
+function swap<T>(pair: Pair<T>): Pair<T> {
+    return [pair[1], pair[0]];
+}
+
+function sum(...values: number[]): number {
+    let total: number = 0;
+    for (const value of values) {
+        total += value;
+    }
+    return total;
+}
+
+const square: Shape = { area: (): number => 4 };
+print(swap<number>([1, 2]), sum(1, 2, 3), square.area());
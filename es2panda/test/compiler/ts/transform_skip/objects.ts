@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+const point = {
+    x: 1,
+    y: 2,
+    get length(): number {
+        return Math.sqrt(this.x * this.x + this.y * this.y);
+    },
+    scale(factor: number) {
+        return { ...this, x: this.x * factor, y: this.y * factor };
+    }
+};
+
+async function delayed<T>(value: T): Promise<T> {
+    return await Promise.resolve(value);
+}
+
+function* range(end: number): Generator<number> {
+    for (let i = 0; i < end; i++) {
+        yield i;
+    }
+}
+
+delayed(point.scale(2)).then((scaled) => print(scaled.x, [...range(3)], point.length as number));
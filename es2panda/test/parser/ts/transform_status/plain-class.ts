@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+interface Shape {
+    area(): number;
+}
+
+abstract class Base<T> implements Shape {
+    abstract area(): number;
+
+    describe(): string {
+        return "shape";
+    }
+}
+
+export class Square extends Base<number> {
+    static count(): number {
+        return 0;
+    }
+
+    static {
+        Square.count();
+    }
+
+    constructor(side: number) {
+        super();
+    }
+
+    get kind(): string {
+        return "square";
+    }
+
+    area(): number {
+        return 1;
+    }
+}
+
+declare enum Ambient {
+    A,
+}
+
+declare namespace Types {
+    type Id = number;
+}
@@ -164,6 +164,8 @@ def get_args():
         help='run coldfix tests')
     parser.add_argument('--base64', dest='base64', action='store_true', default=False,
         help='run base64 tests')
+    parser.add_argument('--server', dest='server', action='store_true', default=False,
+        help='run compile server tests')
     parser.add_argument('--bytecode', dest='bytecode', action='store_true', default=False,
         help='run bytecode tests')
     parser.add_argument('--debugger', dest='debugger', action='store_true', default=False,
@@ -873,6 +875,10 @@ class CompilerRunner(Runner):
                 files = glob(glob_expression, recursive=True)
                 files = fnmatch.filter(files, self.test_root + '**' + self.args.filter)
                 self.tests.append(CompilerProjectTest(projects_path, project, files, flags))
+        elif directory.endswith("function_cache"):
+            cases_path = path.join(self.test_root, directory)
+            for case in os.listdir(cases_path):
+                self.tests.append(FunctionCacheTest(path.join(cases_path, case), flags))
         else:
             glob_expression = path.join(
                 self.test_root, directory, "**/*.%s" % (extension))
@@ -929,16 +935,73 @@ class CompilerTest(Test):
         return self
 
 
+class FunctionCacheTest(Test):
+    # base.js is compiled into the cache, changed.js then replaces it and reuses the functions left unchanged
+    def __init__(self, test_path, flags):
+        Test.__init__(self, test_path, flags)
+
+    def compile(self, runner, src_path, cache_path, abc_path):
+        cmd = runner.cmd_prefix + [runner.es2panda]
+        cmd.extend(self.flags)
+        cmd.extend(["--cache-file=" + cache_path, "--output=" + abc_path, src_path])
+        self.log_cmd(cmd)
+        process = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        out, err = process.communicate()
+        if err or process.returncode != 0:
+            self.error = err.decode("utf-8", errors="ignore")
+            return False
+        return True
+
+    def run(self, runner):
+        case_name = "function_cache_%s" % path.basename(self.path)
+        src_path = path.join(runner.build_dir, case_name + ".js")
+        cache_path = path.join(runner.build_dir, case_name + ".cache")
+        abc_path = path.join(runner.build_dir, case_name + ".abc")
+        for stale in [cache_path, abc_path]:
+            if path.exists(stale):
+                os.remove(stale)
+
+        self.passed = False
+        shutil.copyfile(path.join(self.path, "base.js"), src_path)
+        if self.compile(runner, src_path, cache_path, abc_path):
+            shutil.copyfile(path.join(self.path, "changed.js"), src_path)
+            if self.compile(runner, src_path, cache_path, abc_path):
+                ld_library_path = runner.ld_library_path
+                os.environ.setdefault("LD_LIBRARY_PATH", ld_library_path)
+                run_abc_cmd = [runner.ark_js_vm, abc_path]
+                self.log_cmd(run_abc_cmd)
+                process = subprocess.Popen(run_abc_cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+                out, err = process.communicate()
+                self.output = out.decode("utf-8", errors="ignore") + err.decode("utf-8", errors="ignore")
+                with open(path.join(self.path, "expected.txt"), 'r') as fp:
+                    expected = fp.read()
+                self.passed = expected == self.output and process.returncode in [0, 1]
+                if not self.passed:
+                    self.error = err.decode("utf-8", errors="ignore")
+
+        for generated in [src_path, cache_path, abc_path]:
+            if path.exists(generated):
+                os.remove(generated)
+
+        return self
+
+
 class CompilerProjectTest(Test):
     def __init__(self, projects_path, project, test_paths, flags):
         Test.__init__(self, "", flags)
         self.projects_path = projects_path
         self.project = project
         self.test_paths = test_paths
-        self.files_info_path = os.path.join(os.path.join(self.projects_path, self.project), 'filesInfo.txt')
+        # A project may be compiled with several sets of flags at the same time, each one gets its own outputs
+        self.variant = re.sub(r'[^0-9A-Za-z]+', '_', '_'.join(flags)).strip('_')
+        self.files_info_path = os.path.join(os.path.join(self.projects_path, self.project),
+                                            'filesInfo_%s.txt' % self.variant)
+
+    def output_root(self, runner):
+        return path.join(runner.build_dir, self.variant)
 
     def remove_project(self, runner):
-        project_path = runner.build_dir + "/" + self.project
+        project_path = self.output_root(runner) + "/" + self.project
         if path.exists(project_path):
             shutil.rmtree(project_path)
         if path.exists(self.files_info_path):
@@ -948,7 +1011,7 @@ class CompilerProjectTest(Test):
         sub_path = self.path[len(self.projects_path):]
         file_relative_path = path.split(sub_path)[0]
         file_name = path.split(sub_path)[1]
-        file_absolute_path = runner.build_dir + "/" + file_relative_path
+        file_absolute_path = self.output_root(runner) + "/" + file_relative_path
         return [file_absolute_path, file_name]
 
     def gen_single_abc(self, runner):
@@ -974,16 +1037,62 @@ class CompilerProjectTest(Test):
                 self.remove_project(runner)
                 return self
 
+    def is_abc_input(self, test_path):
+        # Such a file is compiled on its own first, the merged compilation takes its abc as the input
+        return test_path.endswith("-abc-input.ts")
+
+    def record_name(self, test_path):
+        return os.path.relpath(test_path, os.path.dirname(self.files_info_path)).split('.')[0]
+
+    def abc_input_path(self, runner, test_path):
+        self.path = test_path
+        [file_absolute_path, file_name] = self.get_file_absolute_path_and_name(runner)
+        return path.join(file_absolute_path, "%s.abc" % (path.splitext(file_name)[0]))
+
+    def gen_abc_inputs(self, runner):
+        for test_path in filter(self.is_abc_input, self.test_paths):
+            abc_path = self.abc_input_path(runner, test_path)
+            if not path.exists(path.dirname(abc_path)):
+                os.makedirs(path.dirname(abc_path))
+            es2abc_cmd = runner.cmd_prefix + [runner.es2panda]
+            es2abc_cmd.extend(self.flags)
+            es2abc_cmd.extend(["--record-name=" + self.record_name(test_path), "--output=" + abc_path])
+            es2abc_cmd.append(test_path)
+            self.log_cmd(es2abc_cmd)
+
+            process = subprocess.Popen(es2abc_cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+            out, err = process.communicate()
+            if err:
+                self.passed = False
+                self.error = err.decode("utf-8", errors="ignore")
+                self.remove_project(runner)
+                return self
+
     def gen_files_info(self, runner):
         fd = os.open(self.files_info_path, os.O_RDWR | os.O_CREAT | os.O_TRUNC)
         f = os.fdopen(fd, "w")
         for test_path in self.test_paths:
-            record_name = os.path.relpath(test_path, os.path.dirname(self.files_info_path)).split('.')[0]
+            record_name = self.record_name(test_path)
             module_kind = "esm"
-            file_info = ('%s;%s;%s;%s;%s' % (test_path, record_name, module_kind, test_path, record_name))
+            file_path = self.abc_input_path(runner, test_path) if self.is_abc_input(test_path) else test_path
+            file_info = ('%s;%s;%s;%s;%s' % (file_path, record_name, module_kind, test_path, record_name))
             f.writelines(file_info + '\n')
         f.close()
 
+    def dedup_expected_path(self):
+        # A project checking the literal array deduplication holds the number of arrays expected to be merged
+        return os.path.join(self.projects_path, self.project, 'dedup-expected.txt')
+
+    def check_dedup(self, out):
+        with open(self.dedup_expected_path(), 'r') as fp:
+            expected = fp.read().strip()
+        removed = re.search(r'Literal array deduplication: (\d+) of \d+ arrays', out.decode("utf-8", errors="ignore"))
+        if removed is None or removed.group(1) != expected:
+            self.passed = False
+            self.error = "Merged literal arrays: %s, expected: %s" % (removed.group(1) if removed else "none", expected)
+            return False
+        return True
+
     def gen_merged_abc(self, runner):
         for test_path in self.test_paths:
             self.path = test_path
@@ -996,8 +1105,13 @@ class CompilerProjectTest(Test):
                 output_abc_name = path.join(file_absolute_path, test_abc_name)
         es2abc_cmd = runner.cmd_prefix + [runner.es2panda]
         es2abc_cmd.extend(self.flags)
+        if any(map(self.is_abc_input, self.test_paths)):
+            es2abc_cmd.append("--enable-abc-input")
+        check_dedup = "--dedup-literal-arrays" in self.flags and path.exists(self.dedup_expected_path())
+        if check_dedup:
+            es2abc_cmd.append("--dump-size-stat")
         es2abc_cmd.extend(['%s%s' % ("--output=", output_abc_name)])
-        es2abc_cmd.append('@' + os.path.join(os.path.dirname(exec_file_path), "filesInfo.txt"))
+        es2abc_cmd.append('@' + self.files_info_path)
         self.log_cmd(es2abc_cmd)
         process = subprocess.Popen(es2abc_cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
         out, err = process.communicate()
@@ -1006,12 +1120,17 @@ class CompilerProjectTest(Test):
             self.error = err.decode("utf-8", errors="ignore")
             self.remove_project(runner)
             return self
+        if check_dedup and not self.check_dedup(out):
+            self.remove_project(runner)
+            return self
 
     def run(self, runner):
         # Compile all ts source files in the project to abc files.
         if ("--merge-abc" in self.flags):
+            self.gen_abc_inputs(runner)
             self.gen_files_info(runner)
-            self.gen_merged_abc(runner)
+            if self.gen_merged_abc(runner):
+                return self
         else:
             self.gen_single_abc(runner)
 
@@ -1355,6 +1474,57 @@ class Base64Runner(Runner):
         return os.path.basename(src)
 
 
+class ServerTest(Test):
+    def __init__(self, test_path):
+        Test.__init__(self, test_path, "")
+
+    def run(self, runner):
+        # Every request line is answered with its exit code, the replies have to be the only output on stdout
+        requests_path = os.path.join(self.path, 'requests.txt')
+        try:
+            with open(requests_path, 'r') as fp:
+                requests = (''.join((fp.readlines()[12:]))).lstrip()  # ignore license description lines
+        except Exception:
+            self.passed = False
+            return self
+        requests = requests.replace('{dir}', self.path).replace('{out}', runner.build_dir)
+
+        cmd = runner.cmd_prefix + [runner.es2panda, "--server"]
+        self.log_cmd(cmd)
+
+        process = subprocess.Popen(cmd, stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        stdout, stderr = process.communicate(input=requests.encode("utf-8"), timeout=runner.args.es2panda_timeout)
+        self.output = stdout.decode("utf-8", errors="ignore")
+
+        expected_path = os.path.join(self.path, 'expected.txt')
+        try:
+            with open(expected_path, 'r') as fp:
+                expected = (''.join((fp.readlines()[12:]))).lstrip()
+            self.passed = expected == self.output and process.returncode == 0
+        except Exception:
+            self.passed = False
+
+        if not self.passed:
+            self.error = "expected output:" + os.linesep + expected + os.linesep + "actual output:" + os.linesep +\
+                self.output + os.linesep + stderr.decode("utf-8", errors="ignore")
+
+        return self
+
+
+class ServerRunner(Runner):
+    def __init__(self, args):
+        Runner.__init__(self, args, "Server")
+        self.test_directory = path.join(self.test_root, "server")
+        self.add_test()
+
+    def add_test(self):
+        self.tests = []
+        self.tests.append(ServerTest(os.path.join(self.test_directory, "requests")))
+
+    def test_path(self, src):
+        return os.path.basename(src)
+
+
 class TypeExtractorRunner(Runner):
     def __init__(self, args):
         Runner.__init__(self, args, "TypeExtractor")
@@ -1558,6 +1728,39 @@ class BytecodeRunner(Runner):
     def test_path(self, src):
         return src
 
+class TSTransformSkipTest(Test):
+    # TS input without anything to transform is bound once, the output has to equal the one of the full pipeline
+    def __init__(self, test_path, flags):
+        Test.__init__(self, test_path, flags)
+
+    def dump(self, runner, extra_flags):
+        cmd = runner.cmd_prefix + [runner.es2panda, "--dump-assembly"]
+        cmd.extend(self.flags)
+        cmd.extend(extra_flags)
+        cmd.extend(["--output=" + os.devnull, self.path])
+        self.log_cmd(cmd)
+        process = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        out, err = process.communicate(timeout=runner.args.es2panda_timeout)
+        return out.decode("utf-8", errors="ignore") + err.decode("utf-8", errors="ignore")
+
+    def run(self, runner):
+        self.output = self.dump(runner, [])
+        expected = self.dump(runner, ["--force-ts-transform"])
+        self.passed = expected == self.output
+        if not self.passed:
+            self.error = "output with the transform:" + os.linesep + expected + os.linesep +\
+                "output without the transform:" + os.linesep + self.output
+        return self
+
+
+class TSTransformSkipRunner(BytecodeRunner):
+    def __init__(self, args):
+        Runner.__init__(self, args, "TSTransformSkip")
+
+    def add_directory(self, directory, extension, flags, func=TSTransformSkipTest):
+        BytecodeRunner.add_directory(self, directory, extension, flags, func)
+
+
 def main():
     args = get_args()
 
@@ -1583,6 +1786,8 @@ def main():
         runner.add_directory("parser/sendable_class", "ts", ["--dump-assembly", "--dump-literal-buffer", "--module"])
         runner.add_directory("parser/unicode", "js", ["--parse-only"])
         runner.add_directory("parser/ts/stack_overflow", "ts", ["--parse-only", "--dump-ast"])
+        runner.add_directory("parser/ts/transform_status", "ts",
+                             ["--parse-only", "--module", "--dump-ts-transform-status"])
 
         runners.append(runner)
 
@@ -1634,14 +1839,24 @@ def main():
         runner.add_directory("compiler/ts/cases", "ts", [])
         runner.add_directory("compiler/ts/projects", "ts", ["--module"])
         runner.add_directory("compiler/ts/projects", "ts", ["--module", "--merge-abc"])
+        runner.add_directory("compiler/ts/merge_abc_projects", "ts", ["--module", "--merge-abc"])
+        runner.add_directory("compiler/ts/merge_abc_projects", "ts", ["--module", "--merge-abc", "--dedup-literal-arrays"])
+        runner.add_directory("compiler/ts/merge_abc_projects", "ts", ["--module", "--merge-abc", "--merge-abc-opt"])
         runner.add_directory("compiler/dts", "d.ts", ["--module", "--opt-level=0"])
         runner.add_directory("compiler/commonjs", "js", ["--commonjs"])
         runner.add_directory("compiler/recordsource/with-on", "js", ["--record-source"])
         runner.add_directory("compiler/recordsource/with-off", "js", [])
         runner.add_directory("compiler/interpreter/lexicalEnv", "js", [])
+        runner.add_directory("compiler/interpreter/lexicalEnv", "js", ["--hoist-loop-lexicals"])
+        runner.add_directory("compiler/function_cache", "js", [])
 
         runners.append(runner)
 
+        ts_transform_skip_runner = TSTransformSkipRunner(args)
+        ts_transform_skip_runner.add_directory("compiler/ts/transform_skip", "ts", ["--module"])
+        ts_transform_skip_runner.add_directory("compiler/ts/cases", "ts", [])
+        runners.append(ts_transform_skip_runner)
+
     if args.hotfix:
         runners.append(HotfixRunner(args))
 
@@ -1657,6 +1872,9 @@ def main():
     if args.base64:
         runners.append(Base64Runner(args))
 
+    if args.server:
+        runners.append(ServerRunner(args))
+
     if args.type_extractor:
         runners.append(TypeExtractorRunner(args))
 
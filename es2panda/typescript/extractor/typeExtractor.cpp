@@ -53,64 +53,26 @@ namespace panda::es2panda::extractor {
 #define TLOG(type, res) static_cast<void>(0)
 #endif
 
-const std::set<ir::AstNodeType> PRUNING_SET = {
-    ir::AstNodeType::IDENTIFIER,
-    ir::AstNodeType::TS_INTERFACE_DECLARATION,
-    ir::AstNodeType::TS_TYPE_ALIAS_DECLARATION,
-    ir::AstNodeType::IMPORT_DECLARATION,
-    ir::AstNodeType::EXPORT_ALL_DECLARATION
-};
+// Traversal pruning, subtrees of these nodes hold no declarations the extractor is interested in
+static bool IsPruningNode(ir::AstNodeType type)
+{
+    switch (type) {
+        case ir::AstNodeType::IDENTIFIER:
+        case ir::AstNodeType::TS_INTERFACE_DECLARATION:
+        case ir::AstNodeType::TS_TYPE_ALIAS_DECLARATION:
+        case ir::AstNodeType::IMPORT_DECLARATION:
+        case ir::AstNodeType::EXPORT_ALL_DECLARATION:
+            return true;
+        default:
+            return false;
+    }
+}
 
 TypeExtractor::TypeExtractor(const ir::BlockStatement *rootNode, bool typeDtsExtractor, bool typeDtsBuiltin,
                              ArenaAllocator *allocator, compiler::CompilerContext *context)
     : rootNode_(rootNode), typeDtsExtractor_(typeDtsExtractor), typeDtsBuiltin_(typeDtsBuiltin),
       recorder_(std::make_unique<TypeRecorder>(allocator, context))
 {
-    getterMap_[ir::AstNodeType::IDENTIFIER] =
-        std::bind(&TypeExtractor::GetTypeIndexFromIdentifierNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::CLASS_EXPRESSION] =
-        std::bind(&TypeExtractor::GetTypeIndexFromClassExpression, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::CLASS_DEFINITION] =
-        std::bind(&TypeExtractor::GetTypeIndexFromClassDefinition, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::TS_INTERFACE_DECLARATION] =
-        std::bind(&TypeExtractor::GetTypeIndexFromInterfaceNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::FUNCTION_EXPRESSION] =
-        std::bind(&TypeExtractor::GetTypeIndexFromFunctionNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::ARROW_FUNCTION_EXPRESSION] =
-        std::bind(&TypeExtractor::GetTypeIndexFromFunctionNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::IMPORT_NAMESPACE_SPECIFIER] =
-        std::bind(&TypeExtractor::GetTypeIndexFromImportNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::IMPORT_SPECIFIER] =
-        std::bind(&TypeExtractor::GetTypeIndexFromImportNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::IMPORT_DEFAULT_SPECIFIER] =
-        std::bind(&TypeExtractor::GetTypeIndexFromImportNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::TS_TYPE_ALIAS_DECLARATION] =
-        std::bind(&TypeExtractor::GetTypeIndexFromTypeAliasNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::TS_AS_EXPRESSION] =
-        std::bind(&TypeExtractor::GetTypeIndexFromAsNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::TS_SATISFIES_EXPRESSION] =
-        std::bind(&TypeExtractor::GetTypeIndexFromSatisfiesNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::TS_TYPE_ASSERTION] =
-        std::bind(&TypeExtractor::GetTypeIndexFromAssertionNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::MEMBER_EXPRESSION] =
-        std::bind(&TypeExtractor::GetTypeIndexFromMemberNode, this, std::placeholders::_1, std::placeholders::_2);
-    getterMap_[ir::AstNodeType::TS_QUALIFIED_NAME] =
-        std::bind(&TypeExtractor::GetTypeIndexFromTSQualifiedNode, this, std::placeholders::_1, std::placeholders::_2);
-
-    handlerMap_[ir::AstNodeType::VARIABLE_DECLARATION] =
-        std::bind(&TypeExtractor::HandleVariableDeclaration, this, std::placeholders::_1);
-    handlerMap_[ir::AstNodeType::FUNCTION_DECLARATION] =
-        std::bind(&TypeExtractor::HandleFunctionDeclaration, this, std::placeholders::_1);
-    handlerMap_[ir::AstNodeType::CLASS_DECLARATION] =
-        std::bind(&TypeExtractor::HandleClassDeclaration, this, std::placeholders::_1);
-    handlerMap_[ir::AstNodeType::TS_INTERFACE_DECLARATION] =
-        std::bind(&TypeExtractor::HandleInterfaceDeclaration, this, std::placeholders::_1);
-    handlerMap_[ir::AstNodeType::TS_TYPE_ALIAS_DECLARATION] =
-        std::bind(&TypeExtractor::HandleTypeAliasDeclaration, this, std::placeholders::_1);
-    handlerMap_[ir::AstNodeType::EXPRESSION_STATEMENT] =
-        std::bind(&TypeExtractor::HandleNewlyGenFuncExpression, this, std::placeholders::_1);
-    handlerMap_[ir::AstNodeType::ARROW_FUNCTION_EXPRESSION] =
-        std::bind(&TypeExtractor::HandleArrowFunctionExpression, this, std::placeholders::_1);
 }
 
 void TypeExtractor::StartTypeExtractor(const parser::Program *program)
@@ -152,13 +114,12 @@ void TypeExtractor::ExtractNodesType(const ir::AstNode *parent)
 
 void TypeExtractor::ExtractNodeType(const ir::AstNode *parent, const ir::AstNode *childNode)
 {
-    auto iter = handlerMap_.find(childNode->Type());
-    if (iter != handlerMap_.end()) {
-        iter->second(childNode);
+    auto handler = HandlerOf(childNode->Type());
+    if (handler != nullptr) {
+        (this->*handler)(childNode);
     }
 
-    // Traversal pruning
-    if (PRUNING_SET.find(childNode->Type()) != PRUNING_SET.end()) {
+    if (IsPruningNode(childNode->Type())) {
         return;
     }
 
@@ -366,13 +327,70 @@ const ir::AstNode *TypeExtractor::GetDeclNodeFromInitializer(const ir::Expressio
 
 int64_t TypeExtractor::GetTypeIndexFromDeclNode(const ir::AstNode *node, bool isNewInstance)
 {
-    auto iter = getterMap_.find(node->Type());
-    if (iter != getterMap_.end()) {
-        return iter->second(node, isNewInstance);
+    auto getter = GetterOf(node->Type());
+    if (getter != nullptr) {
+        return (this->*getter)(node, isNewInstance);
     }
     return PrimitiveType::ANY;
 }
 
+TypeExtractor::Getter TypeExtractor::GetterOf(ir::AstNodeType type)
+{
+    switch (type) {
+        case ir::AstNodeType::IDENTIFIER:
+            return &TypeExtractor::GetTypeIndexFromIdentifierNode;
+        case ir::AstNodeType::CLASS_EXPRESSION:
+            return &TypeExtractor::GetTypeIndexFromClassExpression;
+        case ir::AstNodeType::CLASS_DEFINITION:
+            return &TypeExtractor::GetTypeIndexFromClassDefinition;
+        case ir::AstNodeType::TS_INTERFACE_DECLARATION:
+            return &TypeExtractor::GetTypeIndexFromInterfaceNode;
+        case ir::AstNodeType::FUNCTION_EXPRESSION:
+        case ir::AstNodeType::ARROW_FUNCTION_EXPRESSION:
+            return &TypeExtractor::GetTypeIndexFromFunctionNode;
+        case ir::AstNodeType::IMPORT_NAMESPACE_SPECIFIER:
+        case ir::AstNodeType::IMPORT_SPECIFIER:
+        case ir::AstNodeType::IMPORT_DEFAULT_SPECIFIER:
+            return &TypeExtractor::GetTypeIndexFromImportNode;
+        case ir::AstNodeType::TS_TYPE_ALIAS_DECLARATION:
+            return &TypeExtractor::GetTypeIndexFromTypeAliasNode;
+        case ir::AstNodeType::TS_AS_EXPRESSION:
+            return &TypeExtractor::GetTypeIndexFromAsNode;
+        case ir::AstNodeType::TS_SATISFIES_EXPRESSION:
+            return &TypeExtractor::GetTypeIndexFromSatisfiesNode;
+        case ir::AstNodeType::TS_TYPE_ASSERTION:
+            return &TypeExtractor::GetTypeIndexFromAssertionNode;
+        case ir::AstNodeType::MEMBER_EXPRESSION:
+            return &TypeExtractor::GetTypeIndexFromMemberNode;
+        case ir::AstNodeType::TS_QUALIFIED_NAME:
+            return &TypeExtractor::GetTypeIndexFromTSQualifiedNode;
+        default:
+            return nullptr;
+    }
+}
+
+TypeExtractor::Handler TypeExtractor::HandlerOf(ir::AstNodeType type)
+{
+    switch (type) {
+        case ir::AstNodeType::VARIABLE_DECLARATION:
+            return &TypeExtractor::HandleVariableDeclaration;
+        case ir::AstNodeType::FUNCTION_DECLARATION:
+            return &TypeExtractor::HandleFunctionDeclaration;
+        case ir::AstNodeType::CLASS_DECLARATION:
+            return &TypeExtractor::HandleClassDeclaration;
+        case ir::AstNodeType::TS_INTERFACE_DECLARATION:
+            return &TypeExtractor::HandleInterfaceDeclaration;
+        case ir::AstNodeType::TS_TYPE_ALIAS_DECLARATION:
+            return &TypeExtractor::HandleTypeAliasDeclaration;
+        case ir::AstNodeType::EXPRESSION_STATEMENT:
+            return &TypeExtractor::HandleNewlyGenFuncExpression;
+        case ir::AstNodeType::ARROW_FUNCTION_EXPRESSION:
+            return &TypeExtractor::HandleArrowFunctionExpression;
+        default:
+            return nullptr;
+    }
+}
+
 int64_t TypeExtractor::GetTypeIndexFromIdentifierNode(const ir::AstNode *node, bool isNewInstance)
 {
     auto typeIndex = recorder_->GetNodeTypeIndex(node);
@@ -1067,9 +1085,9 @@ void TypeExtractor::GetVariablesFromNamespace(const binder::NamespaceVariable *v
 // static
 int64_t TypeExtractor::GetBuiltinTypeIndex(util::StringView name)
 {
-    auto t = BUILTIN_TYPE_MAP.find(std::string(name));
-    if (t != BUILTIN_TYPE_MAP.end()) {
-        return t->second;
+    auto t = FindBuiltinType(name.Utf8());
+    if (t.has_value()) {
+        return t.value();
     }
     return PrimitiveType::ANY;
 }
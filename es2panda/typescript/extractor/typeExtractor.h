@@ -24,9 +24,6 @@
 
 namespace panda::es2panda::extractor {
 
-using Getter = std::function<int64_t(const ir::AstNode *, bool isNewInstance)>;
-using Handler = std::function<void(const ir::AstNode *)>;
-
 class TypeExtractor {
 public:
     explicit TypeExtractor(const ir::BlockStatement *rootNode, bool typeDtsExtractor, bool typeDtsBuiltin,
@@ -83,13 +80,16 @@ public:
     }
 
 private:
+    // Node kinds are dispatched through a switch instead of a map of bound std::function objects,
+    // the extractor visits every node of the program and the lookup is on its hot path
+    using Getter = int64_t (TypeExtractor::*)(const ir::AstNode *, bool isNewInstance);
+    using Handler = void (TypeExtractor::*)(const ir::AstNode *);
+
     const ir::BlockStatement *rootNode_;
     std::unordered_set<const ir::Expression *> searchingTypeRefNodes_;
     const bool typeDtsExtractor_;
     const bool typeDtsBuiltin_;
     std::unique_ptr<TypeRecorder> recorder_;
-    std::unordered_map<ir::AstNodeType, Getter> getterMap_;
-    std::unordered_map<ir::AstNodeType, Handler> handlerMap_;
     const ArenaMap<util::StringView, int64_t> *genericParamTypeMap_ {nullptr};
 
     void ExtractNodesType(const ir::AstNode *parent);
@@ -101,6 +101,9 @@ private:
 
     const ir::AstNode *GetDeclNodeFromInitializer(const ir::Expression *initializer, const ir::Identifier **variable);
 
+    static Getter GetterOf(ir::AstNodeType type);
+    static Handler HandlerOf(ir::AstNodeType type);
+
     int64_t GetTypeIndexFromDeclNode(const ir::AstNode *node, bool isNewInstance);
     int64_t GetTypeIndexFromIdentifierNode(const ir::AstNode *node, bool isNewInstance);
     int64_t GetTypeIndexFromClassExpression(const ir::AstNode *node, bool isNewInstance);
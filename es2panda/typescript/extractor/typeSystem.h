@@ -16,7 +16,11 @@
 #ifndef ES2PANDA_TYPESCRIPT_EXACTOR_TYPESYSTEM_H
 #define ES2PANDA_TYPESCRIPT_EXACTOR_TYPESYSTEM_H
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <optional>
+#include <string_view>
 
 #include <binder/variable.h>
 #include <compiler/base/literals.h>
@@ -143,70 +147,99 @@ enum BuiltinType : uint8_t {
     BT_INTL,
 };
 
-const std::unordered_map<std::string, BuiltinType> BUILTIN_TYPE_MAP = {
-    {"Function", BuiltinType::BT_FUNCTION},
-    {"RangeError", BuiltinType::BT_RANGEERROR},
-    {"Error", BuiltinType::BT_ERROR},
-    {"Object", BuiltinType::BT_OBJECT},
-    {"SyntaxError", BuiltinType::BT_SYNTAXERROR},
-    {"TypeError", BuiltinType::BT_TYPEERROR},
-    {"ReferenceError", BuiltinType::BT_REFERENCEERROR},
-    {"URIError", BuiltinType::BT_URIERROR},
-    {"Symbol", BuiltinType::BT_SYMBOL},
-    {"EvalError", BuiltinType::BT_EVALERROR},
-    {"Number", BuiltinType::BT_NUMBER},
-    {"parseFloat", BuiltinType::BT_PARSEFLOAT},
-    {"Date", BuiltinType::BT_DATE},
-    {"Boolean", BuiltinType::BT_BOOLEAN},
-    {"BigInt", BuiltinType::BT_BIGINT},
-    {"parseInt", BuiltinType::BT_PARSEINT},
-    {"WeakMap", BuiltinType::BT_WEAKMAP},
-    {"RegExp", BuiltinType::BT_REGEXP},
-    {"Set", BuiltinType::BT_SET},
-    {"Map", BuiltinType::BT_MAP},
-    {"WeakRef", BuiltinType::BT_WEAKREF},
-    {"WeakSet", BuiltinType::BT_WEAKSET},
-    {"FinalizationRegistry", BuiltinType::BT_FINALIZATIONREGISTRY},
-    {"Array", BuiltinType::BT_ARRAY},
-    {"Uint8ClampedArray", BuiltinType::BT_UINT8CLAMPEDARRAY},
-    {"Uint8Array", BuiltinType::BT_UINT8ARRAY},
-    {"TypedArray", BuiltinType::BT_TYPEDARRAY},
-    {"Int8Array", BuiltinType::BT_INT8ARRAY},
-    {"Uint16Array", BuiltinType::BT_UINT16ARRAY},
-    {"Uint32Array", BuiltinType::BT_UINT32ARRAY},
-    {"Int16Array", BuiltinType::BT_INT16ARRAY},
-    {"Int32Array", BuiltinType::BT_INT32ARRAY},
-    {"Float32Array", BuiltinType::BT_FLOAT32ARRAY},
-    {"Float64Array", BuiltinType::BT_FLOAT64ARRAY},
-    {"BigInt64Array", BuiltinType::BT_BIGINT64ARRAY},
-    {"BigUint64Array", BuiltinType::BT_BIGUINT64ARRAY},
-    {"SharedArrayBuffer", BuiltinType::BT_SHAREDARRAYBUFFER},
-    {"DataView", BuiltinType::BT_DATAVIEW},
-    {"String", BuiltinType::BT_STRING},
-    {"ArrayBuffer", BuiltinType::BT_ARRAYBUFFER},
-    {"eval", BuiltinType::BT_EVAL},
-    {"isFinite", BuiltinType::BT_ISFINITE},
-    {"ArkPrivate", BuiltinType::BT_ARKPRIVATE},
-    {"print", BuiltinType::BT_PRINT},
-    {"decodeURI", BuiltinType::BT_DECODEURI},
-    {"decodeURIComponent", BuiltinType::BT_DECODEURICOMPONENT},
-    {"isNaN", BuiltinType::BT_ISNAN},
-    {"encodeURI", BuiltinType::BT_ENCODEURI},
-    {"NaN", BuiltinType::BT_NAN},
-    {"globalThis", BuiltinType::BT_GLOBALTHIS},
-    {"encodeURIComponent", BuiltinType::BT_ENCODEURICOMPONENT},
-    {"Infinity", BuiltinType::BT_INFINITY},
-    {"Math", BuiltinType::BT_MATH},
-    {"JSON", BuiltinType::BT_JSON},
-    {"Atomics", BuiltinType::BT_ATOMICS},
-    {"undefined", BuiltinType::BT_UNDEFINED},
-    {"Reflect", BuiltinType::BT_REFLECT},
-    {"Promise", BuiltinType::BT_PROMISE},
-    {"Proxy", BuiltinType::BT_PROXY},
-    {"GeneratorFunction", BuiltinType::BT_GENERATORFUNCTION},
-    {"Intl", BuiltinType::BT_INTL},
+struct BuiltinTypeEntry {
+    std::string_view name;
+    BuiltinType type;
 };
 
+// Sorted by name, so that a global name is resolved by binary search without building a std::string key
+constexpr std::array BUILTIN_TYPE_TABLE = {
+    BuiltinTypeEntry {"ArkPrivate", BuiltinType::BT_ARKPRIVATE},
+    BuiltinTypeEntry {"Array", BuiltinType::BT_ARRAY},
+    BuiltinTypeEntry {"ArrayBuffer", BuiltinType::BT_ARRAYBUFFER},
+    BuiltinTypeEntry {"Atomics", BuiltinType::BT_ATOMICS},
+    BuiltinTypeEntry {"BigInt", BuiltinType::BT_BIGINT},
+    BuiltinTypeEntry {"BigInt64Array", BuiltinType::BT_BIGINT64ARRAY},
+    BuiltinTypeEntry {"BigUint64Array", BuiltinType::BT_BIGUINT64ARRAY},
+    BuiltinTypeEntry {"Boolean", BuiltinType::BT_BOOLEAN},
+    BuiltinTypeEntry {"DataView", BuiltinType::BT_DATAVIEW},
+    BuiltinTypeEntry {"Date", BuiltinType::BT_DATE},
+    BuiltinTypeEntry {"Error", BuiltinType::BT_ERROR},
+    BuiltinTypeEntry {"EvalError", BuiltinType::BT_EVALERROR},
+    BuiltinTypeEntry {"FinalizationRegistry", BuiltinType::BT_FINALIZATIONREGISTRY},
+    BuiltinTypeEntry {"Float32Array", BuiltinType::BT_FLOAT32ARRAY},
+    BuiltinTypeEntry {"Float64Array", BuiltinType::BT_FLOAT64ARRAY},
+    BuiltinTypeEntry {"Function", BuiltinType::BT_FUNCTION},
+    BuiltinTypeEntry {"GeneratorFunction", BuiltinType::BT_GENERATORFUNCTION},
+    BuiltinTypeEntry {"Infinity", BuiltinType::BT_INFINITY},
+    BuiltinTypeEntry {"Int16Array", BuiltinType::BT_INT16ARRAY},
+    BuiltinTypeEntry {"Int32Array", BuiltinType::BT_INT32ARRAY},
+    BuiltinTypeEntry {"Int8Array", BuiltinType::BT_INT8ARRAY},
+    BuiltinTypeEntry {"Intl", BuiltinType::BT_INTL},
+    BuiltinTypeEntry {"JSON", BuiltinType::BT_JSON},
+    BuiltinTypeEntry {"Map", BuiltinType::BT_MAP},
+    BuiltinTypeEntry {"Math", BuiltinType::BT_MATH},
+    BuiltinTypeEntry {"NaN", BuiltinType::BT_NAN},
+    BuiltinTypeEntry {"Number", BuiltinType::BT_NUMBER},
+    BuiltinTypeEntry {"Object", BuiltinType::BT_OBJECT},
+    BuiltinTypeEntry {"Promise", BuiltinType::BT_PROMISE},
+    BuiltinTypeEntry {"Proxy", BuiltinType::BT_PROXY},
+    BuiltinTypeEntry {"RangeError", BuiltinType::BT_RANGEERROR},
+    BuiltinTypeEntry {"ReferenceError", BuiltinType::BT_REFERENCEERROR},
+    BuiltinTypeEntry {"Reflect", BuiltinType::BT_REFLECT},
+    BuiltinTypeEntry {"RegExp", BuiltinType::BT_REGEXP},
+    BuiltinTypeEntry {"Set", BuiltinType::BT_SET},
+    BuiltinTypeEntry {"SharedArrayBuffer", BuiltinType::BT_SHAREDARRAYBUFFER},
+    BuiltinTypeEntry {"String", BuiltinType::BT_STRING},
+    BuiltinTypeEntry {"Symbol", BuiltinType::BT_SYMBOL},
+    BuiltinTypeEntry {"SyntaxError", BuiltinType::BT_SYNTAXERROR},
+    BuiltinTypeEntry {"TypeError", BuiltinType::BT_TYPEERROR},
+    BuiltinTypeEntry {"TypedArray", BuiltinType::BT_TYPEDARRAY},
+    BuiltinTypeEntry {"URIError", BuiltinType::BT_URIERROR},
+    BuiltinTypeEntry {"Uint16Array", BuiltinType::BT_UINT16ARRAY},
+    BuiltinTypeEntry {"Uint32Array", BuiltinType::BT_UINT32ARRAY},
+    BuiltinTypeEntry {"Uint8Array", BuiltinType::BT_UINT8ARRAY},
+    BuiltinTypeEntry {"Uint8ClampedArray", BuiltinType::BT_UINT8CLAMPEDARRAY},
+    BuiltinTypeEntry {"WeakMap", BuiltinType::BT_WEAKMAP},
+    BuiltinTypeEntry {"WeakRef", BuiltinType::BT_WEAKREF},
+    BuiltinTypeEntry {"WeakSet", BuiltinType::BT_WEAKSET},
+    BuiltinTypeEntry {"decodeURI", BuiltinType::BT_DECODEURI},
+    BuiltinTypeEntry {"decodeURIComponent", BuiltinType::BT_DECODEURICOMPONENT},
+    BuiltinTypeEntry {"encodeURI", BuiltinType::BT_ENCODEURI},
+    BuiltinTypeEntry {"encodeURIComponent", BuiltinType::BT_ENCODEURICOMPONENT},
+    BuiltinTypeEntry {"eval", BuiltinType::BT_EVAL},
+    BuiltinTypeEntry {"globalThis", BuiltinType::BT_GLOBALTHIS},
+    BuiltinTypeEntry {"isFinite", BuiltinType::BT_ISFINITE},
+    BuiltinTypeEntry {"isNaN", BuiltinType::BT_ISNAN},
+    BuiltinTypeEntry {"parseFloat", BuiltinType::BT_PARSEFLOAT},
+    BuiltinTypeEntry {"parseInt", BuiltinType::BT_PARSEINT},
+    BuiltinTypeEntry {"print", BuiltinType::BT_PRINT},
+    BuiltinTypeEntry {"undefined", BuiltinType::BT_UNDEFINED},
+};
+
+constexpr bool IsBuiltinTypeTableSorted()
+{
+    for (size_t i = 1; i < BUILTIN_TYPE_TABLE.size(); i++) {
+        if (!(BUILTIN_TYPE_TABLE[i - 1].name < BUILTIN_TYPE_TABLE[i].name)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(IsBuiltinTypeTableSorted());
+static_assert(BUILTIN_TYPE_TABLE.size() == BuiltinType::BT_INTL - BuiltinType::BT_HEAD);
+
+inline std::optional<BuiltinType> FindBuiltinType(std::string_view name)
+{
+    auto it = std::lower_bound(BUILTIN_TYPE_TABLE.begin(), BUILTIN_TYPE_TABLE.end(), name,
+        [](const BuiltinTypeEntry &entry, std::string_view key) { return entry.name < key; });
+    if (it != BUILTIN_TYPE_TABLE.end() && it->name == name) {
+        return it->type;
+    }
+    return std::nullopt;
+}
+
 enum UserType : uint8_t {
     COUNTER,
     CLASS,
@@ -275,9 +308,9 @@ protected:
     void CalculateIndex(const util::StringView &name, int64_t &typeIndex, int64_t &typeIndexShift, bool forBuiltin)
     {
         if (forBuiltin && extractor_->GetTypeDtsBuiltin()) {
-            auto t = BUILTIN_TYPE_MAP.find(std::string(name));
-            if (t != BUILTIN_TYPE_MAP.end()) {
-                typeIndexShift = t->second;
+            auto t = FindBuiltinType(name.Utf8());
+            if (t.has_value()) {
+                typeIndexShift = t.value();
                 typeIndex = typeIndexShift - BuiltinType::BT_HEAD;
             }
         }
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arenaStatistics.h"
+
+#include <vector>
+
+namespace panda::es2panda::util {
+std::atomic<bool> ArenaStatistics::enabled_ {false};
+std::mutex ArenaStatistics::m_;
+std::map<std::string, std::map<std::string_view, ArenaStatistics::Entry>> ArenaStatistics::files_;
+
+void ArenaStatistics::Record(const std::string &file, std::string_view phase, const ArenaAllocator *allocator)
+{
+    if (!enabled_) {
+        return;
+    }
+
+    size_t size = allocator->GetAllocatedSize();
+    std::lock_guard<std::mutex> lock(m_);
+    files_[file.empty() ? "<input>" : file][phase].Add(size);
+}
+
+void ArenaStatistics::Dump(std::ostream &out)
+{
+    std::lock_guard<std::mutex> lock(m_);
+    std::map<std::string_view, Entry> phases;
+    std::vector<std::pair<size_t, const std::string *>> fileTotals;
+    size_t total = 0;
+
+    for (const auto &[file, filePhases] : files_) {
+        size_t fileTotal = 0;
+        for (const auto &[phase, entry] : filePhases) {
+            auto &phaseEntry = phases[phase];
+            phaseEntry.total += entry.total;
+            phaseEntry.arenas += entry.arenas;
+            phaseEntry.max = std::max(phaseEntry.max, entry.max);
+            fileTotal += entry.total;
+        }
+        fileTotals.emplace_back(fileTotal, &file);
+        total += fileTotal;
+    }
+
+    out << "Arena allocator statistic:" << std::endl;
+    for (const auto &[phase, entry] : phases) {
+        out << "phase " << phase << ": " << entry.total << " bytes, " << entry.arenas << " arenas, largest arena "
+            << entry.max << " bytes" << std::endl;
+    }
+
+    // Files driving the memory usage come first
+    std::sort(fileTotals.begin(), fileTotals.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+    for (const auto &[fileTotal, file] : fileTotals) {
+        out << "file " << *file << ": " << fileTotal << " bytes";
+        for (const auto &[phase, entry] : files_.at(*file)) {
+            out << ", " << phase << " " << entry.total;
+        }
+        out << std::endl;
+    }
+
+    out << "total: " << total << std::endl;
+}
+
+void ArenaStatistics::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_);
+    files_.clear();
+}
+}  // namespace panda::es2panda::util
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ES2PANDA_UTIL_ARENA_STATISTICS_H
+#define ES2PANDA_UTIL_ARENA_STATISTICS_H
+
+#include <mem/arena_allocator.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace panda::es2panda::util {
+/*
+ * Collects the memory requested from the compiler arenas, grouped by source file and compilation phase.
+ * Every arena is recorded once, right before it is released, so the numbers are the final size of each arena.
+ */
+class ArenaStatistics {
+public:
+    static constexpr std::string_view PHASE_DRIVER = "driver";
+    static constexpr std::string_view PHASE_CACHE = "cache";
+    static constexpr std::string_view PHASE_PARSE = "parse";
+    static constexpr std::string_view PHASE_CHECK = "check";
+    static constexpr std::string_view PHASE_COMPILE = "compile";
+    static constexpr std::string_view PHASE_FUNCTION = "function";
+
+    static void Enable(bool enable)
+    {
+        enabled_ = enable;
+    }
+
+    static bool IsEnabled()
+    {
+        return enabled_;
+    }
+
+    static void Record(const std::string &file, std::string_view phase, const ArenaAllocator *allocator);
+    static void Dump(std::ostream &out);
+    static void Reset();
+
+private:
+    struct Entry {
+        size_t total {0};
+        size_t arenas {0};
+        size_t max {0};
+
+        void Add(size_t size)
+        {
+            total += size;
+            arenas++;
+            max = std::max(max, size);
+        }
+    };
+
+    static std::atomic<bool> enabled_;
+    static std::mutex m_;
+    static std::map<std::string, std::map<std::string_view, Entry>> files_;
+};
+}  // namespace panda::es2panda::util
+
+#endif
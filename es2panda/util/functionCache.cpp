@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "functionCache.h"
+
+#include <binder/binder.h>
+#include <binder/scope.h>
+#include <binder/variable.h>
+#include <ir/base/scriptFunction.h>
+#include <parser/program/program.h>
+
+#include <sstream>
+
+namespace panda::es2panda::util {
+static uint64_t HashString(const std::string &str)
+{
+    // FNV-1a, reused functions are matched by the digest of their whole source, 32 bits are too few for that
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (char c : str) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static util::StringView NodeSourceCode(binder::Binder *binder, const ir::AstNode *node)
+{
+    return binder->Program()->SourceCode().Substr(node->Start().index, node->End().index);
+}
+
+uint64_t FunctionCache::ScopeShapeHash(binder::Binder *binder, const binder::Scope *scope)
+{
+    if (scope == nullptr) {
+        return 0;
+    }
+
+    auto res = scopeHashes_.find(scope);
+    if (res != scopeHashes_.end()) {
+        return res->second;
+    }
+
+    std::stringstream ss;
+    ss << ScopeShapeHash(binder, scope->Parent()) << ":" << static_cast<uint32_t>(scope->Type());
+
+    if (scope->IsVariableScope()) {
+        ss << ":" << scope->AsVariableScope()->LexicalSlots();
+    }
+
+    // Private names, computed keys and field initializers of a class are compiled into its methods,
+    // so every function nested in a class depends on the whole class body
+    if (scope->IsClassScope() && scope->Node() != nullptr) {
+        ss << ":" << NodeSourceCode(binder, scope->Node()).Mutf8();
+    }
+
+    // Bindings are kept in an unordered map, combine them independently of the iteration order
+    uint64_t bindingsHash = 0;
+    for (const auto &[name, variable] : scope->Bindings()) {
+        std::stringstream binding;
+        binding << name.Mutf8() << ":" << static_cast<uint64_t>(variable->Flags());
+        if (variable->IsLocalVariable() && variable->LexicalBound()) {
+            binding << ":" << variable->AsLocalVariable()->LexIdx();
+        }
+        bindingsHash += HashString(binding.str());
+    }
+    ss << ":" << bindingsHash;
+
+    uint64_t hash = HashString(ss.str());
+    scopeHashes_.emplace(scope, hash);
+    return hash;
+}
+
+void FunctionCache::ComputeKeys(binder::Binder *binder)
+{
+    // Names of the directly nested functions are referenced by the define instructions of the outer one
+    const auto &functions = binder->Functions();
+    std::unordered_map<const binder::FunctionScope *, std::string> nestedNames;
+    for (const auto *function : functions) {
+        const auto *outer = function->Parent();
+        while (outer != nullptr && !outer->IsFunctionVariableScope()) {
+            outer = outer->Parent();
+        }
+        if (outer != nullptr && outer->IsFunctionScope()) {
+            nestedNames[outer->AsFunctionScope()].append(function->InternalName().Mutf8()).append(";");
+        }
+    }
+
+    auto &lineIndex = const_cast<lexer::LineIndex &>(binder->Program()->GetLineIndex());
+    for (const auto *function : functions) {
+        const auto *node = function->Node();
+        if (node == nullptr || !node->IsScriptFunction()) {
+            continue;
+        }
+
+        auto loc = lineIndex.GetLocation(node->Start());
+        std::stringstream ss;
+        ss << optionsFingerprint_ << ":" << function->InternalName().Mutf8() << ":" << loc.line << ":" << loc.col
+           << ":" << ScopeShapeHash(binder, function) << ":" << nestedNames[function] << ":"
+           << node->AsScriptFunction()->SourceCode(binder).Mutf8();
+        const std::string key = ss.str();
+        scopeFunctionKeys_.emplace(function, FunctionKey {HashString(key), key.size()});
+    }
+}
+
+std::optional<panda::pandasm::Function> FunctionCache::TakeFunction(const binder::FunctionScope *scope,
+                                                                    std::set<std::string> &strings)
+{
+    if (previous_ == nullptr) {
+        return std::nullopt;
+    }
+
+    auto key = scopeFunctionKeys_.find(scope);
+    if (key == scopeFunctionKeys_.end()) {
+        return std::nullopt;
+    }
+
+    std::string name = scope->InternalName().Mutf8();
+    auto previousKey = previous_->functionKeys.find(name);
+    if (previousKey == previous_->functionKeys.end() || previousKey->second != key->second) {
+        return std::nullopt;
+    }
+
+    auto &functionTable = previous_->program.function_table;
+    auto cached = functionTable.find(name);
+    if (cached == functionTable.end()) {
+        return std::nullopt;
+    }
+
+    const auto &programStrings = previous_->program.strings;
+    for (const auto &ins : cached->second.ins) {
+        for (const auto &id : ins.ids) {
+            if (programStrings.find(id) != programStrings.end()) {
+                strings.insert(id);
+            }
+        }
+    }
+
+    panda::pandasm::Function function = std::move(cached->second);
+    functionTable.erase(cached);
+    previous_->functionKeys.erase(previousKey);
+
+    std::lock_guard<std::mutex> lock(m_);
+    functionKeys_.emplace(std::move(name), key->second);
+    return function;
+}
+
+bool FunctionCache::IsCacheable(const panda::pandasm::Function &function)
+{
+    // Module variable indexes and concurrent module requests depend on the module record of the whole file
+    if (!function.concurrent_module_requests.empty()) {
+        return false;
+    }
+
+    for (const auto &ins : function.ins) {
+        switch (ins.opcode) {
+            case panda::pandasm::Opcode::LDEXTERNALMODULEVAR:
+            case panda::pandasm::Opcode::WIDE_LDEXTERNALMODULEVAR:
+            case panda::pandasm::Opcode::LDLOCALMODULEVAR:
+            case panda::pandasm::Opcode::WIDE_LDLOCALMODULEVAR:
+            case panda::pandasm::Opcode::STMODULEVAR:
+            case panda::pandasm::Opcode::WIDE_STMODULEVAR:
+            case panda::pandasm::Opcode::GETMODULENAMESPACE:
+            case panda::pandasm::Opcode::WIDE_GETMODULENAMESPACE:
+            case panda::pandasm::Opcode::CALLRUNTIME_LDSENDABLEEXTERNALMODULEVAR:
+            case panda::pandasm::Opcode::CALLRUNTIME_WIDELDSENDABLEEXTERNALMODULEVAR:
+                return false;
+            default:
+                break;
+        }
+    }
+
+    return true;
+}
+
+void FunctionCache::Record(const binder::FunctionScope *scope, const panda::pandasm::Function &function,
+                           bool hasLiteralBuffers)
+{
+    // Literal buffer ids are numbered per file, a cached function using them could clash with the new ones
+    if (hasLiteralBuffers || !IsCacheable(function)) {
+        return;
+    }
+
+    auto key = scopeFunctionKeys_.find(scope);
+    if (key == scopeFunctionKeys_.end()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_);
+    functionKeys_.emplace(function.name, key->second);
+}
+}  // namespace panda::es2panda::util
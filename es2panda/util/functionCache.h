@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ES2PANDA_UTIL_FUNCTION_CACHE_H
+#define ES2PANDA_UTIL_FUNCTION_CACHE_H
+
+#include <assembly-function.h>
+#include <macros.h>
+#include <util/programCache.h>
+
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+namespace panda::es2panda::binder {
+class Binder;
+class FunctionScope;
+class Scope;
+}  // namespace panda::es2panda::binder
+
+namespace panda::es2panda::util {
+/*
+ * Function granular part of the compile cache. Every cacheable function of a program is keyed by its source text,
+ * position, the shape of the enclosing lexical environments and the compile options. When a changed file is
+ * recompiled, functions whose key is equal to the one recorded for the cached program are taken over from it
+ * instead of going through code generation again.
+ */
+class FunctionCache {
+public:
+    explicit FunctionCache(ProgramCache *previous) : previous_(previous) {}
+    NO_COPY_SEMANTIC(FunctionCache);
+    NO_MOVE_SEMANTIC(FunctionCache);
+    ~FunctionCache() = default;
+
+    void SetOptionsFingerprint(std::string fingerprint)
+    {
+        optionsFingerprint_ = std::move(fingerprint);
+    }
+
+    void ComputeKeys(binder::Binder *binder);
+    std::optional<panda::pandasm::Function> TakeFunction(const binder::FunctionScope *scope,
+                                                         std::set<std::string> &strings);
+    void Record(const binder::FunctionScope *scope, const panda::pandasm::Function &function, bool hasLiteralBuffers);
+
+    std::unordered_map<std::string, FunctionKey> TakeFunctionKeys()
+    {
+        return std::move(functionKeys_);
+    }
+
+private:
+    uint64_t ScopeShapeHash(binder::Binder *binder, const binder::Scope *scope);
+    static bool IsCacheable(const panda::pandasm::Function &function);
+
+    ProgramCache *previous_;
+    std::string optionsFingerprint_;
+    std::unordered_map<const binder::Scope *, uint64_t> scopeHashes_;
+    std::unordered_map<const binder::FunctionScope *, FunctionKey> scopeFunctionKeys_;
+    std::unordered_map<std::string, FunctionKey> functionKeys_;
+    std::mutex m_;
+};
+}  // namespace panda::es2panda::util
+
+#endif
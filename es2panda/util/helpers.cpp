@@ -680,6 +680,29 @@ bool Helpers::ReadFileToBuffer(const std::string &file, std::stringstream &ss)
     return true;
 }
 
+std::optional<os::mem::BytePtr> Helpers::MapFileToMemory(const std::string &file)
+{
+    auto fd = os::file::Open(os::file::File::GetExtendedFilePath(file), os::file::Mode::READONLY);
+    if (!fd.IsValid()) {
+        return std::nullopt;
+    }
+
+    auto fileSize = fd.GetFileSize();
+    // Empty files can not be mapped, they are read through the stream
+    if (!fileSize || fileSize.Value() == 0) {
+        fd.Close();
+        return std::nullopt;
+    }
+
+    auto mapped = os::mem::MapFile(fd, os::mem::MMAP_PROT_READ, os::mem::MMAP_FLAG_PRIVATE, fileSize.Value());
+    fd.Close();
+    if (mapped.Get() == nullptr) {
+        return std::nullopt;
+    }
+
+    return std::make_optional(std::move(mapped));
+}
+
 void Helpers::ScanDirectives(ir::ScriptFunction *func, const lexer::LineIndex &lineIndex)
 {
     auto *body = func->Body();
@@ -19,9 +19,11 @@
 #include <binder/variableFlags.h>
 #include <mem/arena_allocator.h>
 #include <os/file.h>
+#include <os/mem.h>
 #include <util/ustring.h>
 
 #include <cmath>
+#include <optional>
 
 namespace panda::es2panda::ir {
 class Expression;
@@ -109,6 +111,7 @@ public:
     template <typename T>
     static T BaseName(T const &path, T const &delims = std::string(panda::os::file::File::GetPathDelim()));
     static bool ReadFileToBuffer(const std::string &file, std::stringstream &ss);
+    static std::optional<os::mem::BytePtr> MapFileToMemory(const std::string &file);
     static void ScanDirectives(ir::ScriptFunction *func, const lexer::LineIndex &lineIndex);
     static std::string GetHashString(const std::string &str);
     static std::wstring Utf8ToUtf16(const std::string &utf8);
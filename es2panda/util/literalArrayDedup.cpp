@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "literalArrayDedup.h"
+
+#include <cstring>
+#include <variant>
+
+namespace panda::es2panda::util {
+bool LiteralArrayDedup::IsSharableUse(panda::pandasm::Opcode opcode)
+{
+    switch (opcode) {
+        case panda::pandasm::Opcode::CREATEOBJECTWITHBUFFER:
+        case panda::pandasm::Opcode::CREATEARRAYWITHBUFFER:
+        case panda::pandasm::Opcode::NEWLEXENVWITHNAME:
+        case panda::pandasm::Opcode::WIDE_NEWLEXENVWITHNAME:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool LiteralArrayDedup::IsSharableContent(const panda::pandasm::LiteralArray &array)
+{
+    // Methods belong to the record they are defined in and nested arrays are referenced by id
+    for (const auto &literal : array.literals_) {
+        switch (literal.tag_) {
+            case panda::panda_file::LiteralTag::TAGVALUE:
+            case panda::panda_file::LiteralTag::BOOL:
+            case panda::panda_file::LiteralTag::INTEGER:
+            case panda::panda_file::LiteralTag::DOUBLE:
+            case panda::panda_file::LiteralTag::STRING:
+            case panda::panda_file::LiteralTag::ACCESSOR:
+            case panda::panda_file::LiteralTag::NULLVALUE:
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+std::string LiteralArrayDedup::ContentKey(const panda::pandasm::LiteralArray &array)
+{
+    std::string key;
+    for (const auto &literal : array.literals_) {
+        key += static_cast<char>(literal.tag_);
+        key += static_cast<char>(literal.value_.index());
+        std::visit([&key](const auto &value) {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, std::string>) {
+                key += std::to_string(value.size());
+                key += ':';
+                key += value;
+            } else {
+                // Compare numbers bitwise, so that NaN matches itself and -0.0 does not match 0.0
+                char bytes[sizeof(T)];
+                std::memcpy(bytes, &value, sizeof(T));
+                key.append(bytes, sizeof(T));
+            }
+        }, literal.value_);
+    }
+    return key;
+}
+
+void LiteralArrayDedup::CollectCandidates(const panda::pandasm::Program &program,
+                                          std::unordered_set<std::string> &candidates) const
+{
+    std::unordered_set<std::string> pinned;
+    for (const auto &[name, function] : program.function_table) {
+        for (const auto &ins : function.ins) {
+            for (const auto &id : ins.ids) {
+                if (program.literalarray_table.find(id) == program.literalarray_table.end()) {
+                    continue;
+                }
+                if (IsSharableUse(ins.opcode)) {
+                    candidates.insert(id);
+                } else {
+                    pinned.insert(id);
+                }
+            }
+        }
+    }
+
+    for (const auto &id : pinned) {
+        candidates.erase(id);
+    }
+}
+
+void LiteralArrayDedup::Deduplicate(panda::pandasm::Program &program)
+{
+    totalArrays_ += program.literalarray_table.size();
+
+    std::unordered_set<std::string> candidates;
+    CollectCandidates(program, candidates);
+
+    // The table is ordered, the first occurrence of a content is kept independently of the hash map order
+    std::unordered_map<std::string, std::string> replacements;
+    for (const auto &[id, array] : program.literalarray_table) {
+        if (candidates.find(id) == candidates.end() || !IsSharableContent(array)) {
+            continue;
+        }
+
+        auto [iter, inserted] = canonical_.emplace(ContentKey(array), id);
+        if (!inserted) {
+            replacements.emplace(id, iter->second);
+        }
+    }
+
+    if (replacements.empty()) {
+        return;
+    }
+
+    for (auto &[name, function] : program.function_table) {
+        for (auto &ins : function.ins) {
+            if (!IsSharableUse(ins.opcode)) {
+                continue;
+            }
+            for (auto &id : ins.ids) {
+                auto replacement = replacements.find(id);
+                if (replacement != replacements.end()) {
+                    id = replacement->second;
+                }
+            }
+        }
+    }
+
+    for (const auto &[id, canonicalId] : replacements) {
+        auto iter = program.literalarray_table.find(id);
+        removedLiterals_ += iter->second.literals_.size();
+        program.literalarray_table.erase(iter);
+        removedArrays_++;
+    }
+}
+
+void LiteralArrayDedup::Run(const std::map<std::string, ProgramCache *> &programsInfo,
+                            const std::unordered_map<std::string, std::string> &cacheFiles)
+{
+    for (const auto &[name, cache] : programsInfo) {
+        // The program is still to be written to its cache file, which has to hold the ids of its own record
+        if (cache->needUpdateCache && cacheFiles.find(name) != cacheFiles.end()) {
+            continue;
+        }
+        Deduplicate(cache->program);
+    }
+}
+
+void LiteralArrayDedup::DumpStatistic(std::ostream &out) const
+{
+    out << "Literal array deduplication: " << removedArrays_ << " of " << totalArrays_ << " arrays, "
+        << removedLiterals_ << " literals removed" << std::endl;
+}
+}  // namespace panda::es2panda::util
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ES2PANDA_UTIL_LITERAL_ARRAY_DEDUP_H
+#define ES2PANDA_UTIL_LITERAL_ARRAY_DEDUP_H
+
+#include <assembly-program.h>
+#include <macros.h>
+#include <util/programCache.h>
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace panda::es2panda::util {
+/*
+ * Shares literal arrays with equal content between the programs of a merged abc. Only buffers of object and
+ * array templates and of lexical environment scope names are considered: codegen references them from a single
+ * instruction, so they can be replaced by an equal buffer of another record by rewriting that instruction.
+ */
+class LiteralArrayDedup {
+public:
+    LiteralArrayDedup() = default;
+    NO_COPY_SEMANTIC(LiteralArrayDedup);
+    NO_MOVE_SEMANTIC(LiteralArrayDedup);
+    ~LiteralArrayDedup() = default;
+
+    void Run(const std::map<std::string, ProgramCache *> &programsInfo,
+             const std::unordered_map<std::string, std::string> &cacheFiles);
+    void DumpStatistic(std::ostream &out) const;
+
+private:
+    static bool IsSharableUse(panda::pandasm::Opcode opcode);
+    static bool IsSharableContent(const panda::pandasm::LiteralArray &array);
+    static std::string ContentKey(const panda::pandasm::LiteralArray &array);
+
+    void CollectCandidates(const panda::pandasm::Program &program, std::unordered_set<std::string> &candidates) const;
+    void Deduplicate(panda::pandasm::Program &program);
+
+    // Content of a literal array to the id of its first occurrence
+    std::unordered_map<std::string, std::string> canonical_;
+    size_t totalArrays_ {0};
+    size_t removedArrays_ {0};
+    size_t removedLiterals_ {0};
+};
+}  // namespace panda::es2panda::util
+
+#endif
@@ -32,10 +32,11 @@ void ModuleHelpers::CompileNpmModuleEntryList(const std::string &entriesInfo,
     uint32_t hash = 0;
     auto cacheFileIter = options.cacheFiles.find(entriesInfo);
     if (cacheFileIter != options.cacheFiles.end()) {
-        hash = GetHash32String(reinterpret_cast<const uint8_t *>(ss.str().c_str()));
+        const std::string entries = ss.str();
+        hash = GetHash32(reinterpret_cast<const uint8_t *>(entries.data()), entries.size());
 
-        auto cacheProgramInfo = panda::proto::ProtobufSnapshotGenerator::GetCacheContext(cacheFileIter->second,
-            allocator);
+        util::ArenaProgramCachePtr cacheProgramInfo(
+            panda::proto::ProtobufSnapshotGenerator::GetCacheContext(cacheFileIter->second, allocator));
         if (cacheProgramInfo != nullptr && cacheProgramInfo->hashCode == hash) {
             auto *cache = allocator->New<util::ProgramCache>(hash, std::move(cacheProgramInfo->program));
             progsInfo.insert({entriesInfo, cache});
@@ -63,6 +64,7 @@ void ModuleHelpers::CompileNpmModuleEntryList(const std::string &entriesInfo,
     }
 
     auto *cache = allocator->New<util::ProgramCache>(hash, std::move(*prog), true);
+    prog->~Program();
     progsInfo.insert({entriesInfo, cache});
 }
 }  // namespace panda::es2panda::util
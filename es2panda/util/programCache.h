@@ -19,11 +19,37 @@
 #include <assembly-program.h>
 #include <assemblyProgramProto.h>
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
 namespace panda::es2panda::util {
+// Digest of everything a compiled function depends on, the length of the digested text guards the hash
+struct FunctionKey {
+    uint64_t hash {0};
+    uint64_t length {0};
+
+    bool operator==(const FunctionKey &other) const
+    {
+        return hash == other.hash && length == other.length;
+    }
+
+    bool operator!=(const FunctionKey &other) const
+    {
+        return !(*this == other);
+    }
+};
+
 struct ProgramCache {
     uint32_t hashCode;
     panda::pandasm::Program program;
     bool needUpdateCache { false };
+    // Set when the program has already been written out and released right after its compilation
+    bool emitted { false };
+    // Key of every function which can be taken over by a later compilation of the changed file
+    std::unordered_map<std::string, FunctionKey> functionKeys {};
 
     ProgramCache(uint32_t hashCode, panda::pandasm::Program program) : hashCode(hashCode), program(std::move(program))
     {
@@ -34,5 +60,26 @@ struct ProgramCache {
     {
     }
 };
+
+// Caches are placed into arenas, which release their memory without running the destructors
+struct ProgramCacheDestroyer {
+    void operator()(ProgramCache *cache) const
+    {
+        cache->~ProgramCache();
+    }
+};
+
+using ArenaProgramCachePtr = std::unique_ptr<ProgramCache, ProgramCacheDestroyer>;
+
+inline void DestroyProgramCaches(std::map<std::string, ProgramCache *> &programsInfo)
+{
+    for (auto &[name, cache] : programsInfo) {
+        ProgramCacheDestroyer {}(cache);
+    }
+    programsInfo.clear();
+}
+
+// Called on the file worker as soon as a program is compiled, the program may be released afterwards
+using EmitProgramCallback = std::function<void(const std::string &fileName, ProgramCache *cache)>;
 } //panda::es2panda::util
 #endif
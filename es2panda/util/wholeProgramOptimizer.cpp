@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "wholeProgramOptimizer.h"
+
+#include <binder/binder.h>
+
+#include <optional>
+#include <set>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace panda::es2panda::util {
+template <typename Callback>
+static void ForEachInsReference(const panda::pandasm::Function &function, const Callback &callback)
+{
+    for (size_t i = 0; i < function.ins.size(); i++) {
+        for (const auto &id : function.ins[i].ids) {
+            callback(id, i);
+        }
+    }
+}
+
+template <typename Callback>
+static void ForEachLiteralReference(const panda::pandasm::LiteralArray &array, const Callback &callback)
+{
+    // Methods and nested arrays are named by string literals, whatever their tag is
+    for (const auto &literal : array.literals_) {
+        if (const auto *value = std::get_if<std::string>(&literal.value_)) {
+            callback(*value);
+        }
+    }
+}
+
+static std::optional<int64_t> ModuleVariableIndex(const panda::pandasm::Ins &ins)
+{
+    if (ins.imms.empty() || !std::holds_alternative<int64_t>(ins.imms[0])) {
+        return std::nullopt;
+    }
+    return std::get<int64_t>(ins.imms[0]);
+}
+
+static bool IsMainFunctionName(std::string_view name)
+{
+    // The entry is named by the record in a merged abc
+    const std::string_view mainName = binder::Binder::MAIN_FUNC_NAME;
+    return name == mainName || (name.size() > mainName.size() && name[name.size() - mainName.size() - 1] == '.' &&
+                                name.substr(name.size() - mainName.size()) == mainName);
+}
+
+panda::pandasm::Function *WholeProgramOptimizer::FindMainFunction(panda::pandasm::Program &program)
+{
+    for (auto &[name, function] : program.function_table) {
+        if (IsMainFunctionName(name)) {
+            return &function;
+        }
+    }
+    return nullptr;
+}
+
+bool WholeProgramOptimizer::IsSingleRecordProgram(const std::string &fileName, const panda::pandasm::Program &program)
+{
+    // An abc input may hold any number of records, and its code was not generated by this compilation
+    constexpr std::string_view ABC_SUFFIX = ".abc";
+    if (fileName.size() >= ABC_SUFFIX.size() &&
+        std::string_view(fileName).substr(fileName.size() - ABC_SUFFIX.size()) == ABC_SUFFIX) {
+        return false;
+    }
+
+    // Every record of the code has its own entry
+    size_t mainFunctions = 0;
+    for (const auto &[name, function] : program.function_table) {
+        if (IsMainFunctionName(name)) {
+            mainFunctions++;
+        }
+    }
+    return mainFunctions == 1;
+}
+
+bool WholeProgramOptimizer::IsConstantLoad(panda::pandasm::Opcode opcode)
+{
+    switch (opcode) {
+        case panda::pandasm::Opcode::LDAI:
+        case panda::pandasm::Opcode::FLDAI:
+        case panda::pandasm::Opcode::LDA_STR:
+        case panda::pandasm::Opcode::LDTRUE:
+        case panda::pandasm::Opcode::LDFALSE:
+        case panda::pandasm::Opcode::LDNULL:
+        case panda::pandasm::Opcode::LDUNDEFINED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::unordered_set<std::string> WholeProgramOptimizer::CollectReferencedArrays(const panda::pandasm::Program &program)
+{
+    const auto &arrays = program.literalarray_table;
+    std::unordered_set<std::string> referenced;
+    auto collect = [&arrays, &referenced](const std::string &id) {
+        if (arrays.find(id) != arrays.end()) {
+            referenced.insert(id);
+        }
+    };
+
+    for (const auto &[name, function] : program.function_table) {
+        ForEachInsReference(function, [&collect](const std::string &id, size_t) { collect(id); });
+    }
+    for (const auto &[id, array] : arrays) {
+        ForEachLiteralReference(array, collect);
+    }
+    return referenced;
+}
+
+void WholeProgramOptimizer::PruneStrings(panda::pandasm::Program &program)
+{
+    // Strings of a program are the string operands of its instructions
+    std::set<std::string> strings;
+    for (const auto &[name, function] : program.function_table) {
+        ForEachInsReference(function, [&program, &strings](const std::string &id, size_t) {
+            if (program.strings.find(id) != program.strings.end()) {
+                strings.insert(id);
+            }
+        });
+    }
+    program.strings = std::move(strings);
+}
+
+void WholeProgramOptimizer::RemoveDeadFunctions(panda::pandasm::Program &program)
+{
+    auto &functions = program.function_table;
+    auto &arrays = program.literalarray_table;
+    totalFunctions_ += functions.size();
+
+    auto *main = FindMainFunction(program);
+    if (main == nullptr) {
+        return;
+    }
+
+    std::unordered_set<std::string> liveFunctions {main->name};
+    std::unordered_set<std::string> liveArrays;
+    std::vector<const panda::pandasm::Function *> functionQueue {main};
+    std::vector<const panda::pandasm::LiteralArray *> arrayQueue;
+
+    // Arrays nothing in the code refers to are used by records, e.g. the module record, and are kept with their uses
+    auto referencedArrays = CollectReferencedArrays(program);
+    for (const auto &[id, array] : arrays) {
+        if (referencedArrays.find(id) == referencedArrays.end()) {
+            liveArrays.insert(id);
+            arrayQueue.push_back(&array);
+        }
+    }
+
+    auto mark = [&](const std::string &name) {
+        auto function = functions.find(name);
+        if (function != functions.end() && liveFunctions.insert(name).second) {
+            functionQueue.push_back(&function->second);
+        }
+        auto array = arrays.find(name);
+        if (array != arrays.end() && liveArrays.insert(name).second) {
+            arrayQueue.push_back(&array->second);
+        }
+    };
+
+    while (!functionQueue.empty() || !arrayQueue.empty()) {
+        if (!functionQueue.empty()) {
+            const auto *function = functionQueue.back();
+            functionQueue.pop_back();
+            ForEachInsReference(*function, [&mark](const std::string &id, size_t) { mark(id); });
+            continue;
+        }
+        const auto *array = arrayQueue.back();
+        arrayQueue.pop_back();
+        ForEachLiteralReference(*array, mark);
+    }
+
+    size_t removed = 0;
+    for (auto iter = functions.begin(); iter != functions.end();) {
+        if (liveFunctions.find(iter->first) != liveFunctions.end()) {
+            ++iter;
+            continue;
+        }
+        iter = functions.erase(iter);
+        removed++;
+    }
+    for (auto iter = arrays.begin(); iter != arrays.end();) {
+        if (liveArrays.find(iter->first) != liveArrays.end()) {
+            ++iter;
+            continue;
+        }
+        iter = arrays.erase(iter);
+        removedArrays_++;
+    }
+
+    if (removed != 0) {
+        removedFunctions_ += removed;
+        PruneStrings(program);
+    }
+}
+
+void WholeProgramOptimizer::PropagateModuleConstants(panda::pandasm::Program &program)
+{
+    auto *main = FindMainFunction(program);
+    if (main == nullptr) {
+        return;
+    }
+
+    // Instructions up to the first jump or label run in order, a store there precedes everything after it
+    auto &mainIns = main->ins;
+    size_t straightEnd = 0;
+    while (straightEnd < mainIns.size() && !mainIns[straightEnd].set_label) {
+        if (mainIns[straightEnd++].IsJump()) {
+            break;
+        }
+    }
+
+    // Module variable index to the main function position of its only store
+    std::unordered_map<int64_t, size_t> stores;
+    std::unordered_set<int64_t> rejected;
+    for (const auto &[name, function] : program.function_table) {
+        for (size_t i = 0; i < function.ins.size(); i++) {
+            const auto &ins = function.ins[i];
+            if (ins.opcode != panda::pandasm::Opcode::STMODULEVAR &&
+                ins.opcode != panda::pandasm::Opcode::WIDE_STMODULEVAR) {
+                continue;
+            }
+            auto index = ModuleVariableIndex(ins);
+            if (!index.has_value()) {
+                continue;
+            }
+            bool isConstant = &function == main && i > 0 && i < straightEnd &&
+                              IsConstantLoad(function.ins[i - 1].opcode);
+            if (!isConstant || !stores.emplace(*index, i).second) {
+                rejected.insert(*index);
+            }
+        }
+    }
+    for (auto index : rejected) {
+        stores.erase(index);
+    }
+    if (stores.empty()) {
+        return;
+    }
+
+    // Every function and array gets the earliest main function position after which it may be run or used,
+    // counted from 1; arrays used by records may be used at any time
+    constexpr size_t ANY_TIME = 0;
+    std::unordered_map<std::string, size_t> runsAfter;
+    auto lower = [&runsAfter](const std::string &name, size_t position) {
+        auto [iter, inserted] = runsAfter.emplace(name, position);
+        if (!inserted && position < iter->second) {
+            iter->second = position;
+            return true;
+        }
+        return inserted;
+    };
+    auto isKnown = [&program](const std::string &name) {
+        return program.function_table.find(name) != program.function_table.end() ||
+               program.literalarray_table.find(name) != program.literalarray_table.end();
+    };
+
+    auto referencedArrays = CollectReferencedArrays(program);
+    for (const auto &[id, array] : program.literalarray_table) {
+        if (referencedArrays.find(id) == referencedArrays.end()) {
+            lower(id, ANY_TIME);
+        }
+    }
+    ForEachInsReference(*main, [&](const std::string &id, size_t i) {
+        if (isKnown(id)) {
+            lower(id, i + 1);
+        }
+    });
+
+    auto settle = [&]() {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            auto propagate = [&](const std::string &id, size_t position) {
+                if (isKnown(id) && lower(id, position)) {
+                    changed = true;
+                }
+            };
+            for (const auto &[name, function] : program.function_table) {
+                auto position = runsAfter.find(name);
+                if (&function == main || position == runsAfter.end()) {
+                    continue;
+                }
+                ForEachInsReference(function, [&](const std::string &id, size_t) { propagate(id, position->second); });
+            }
+            for (const auto &[id, array] : program.literalarray_table) {
+                auto position = runsAfter.find(id);
+                if (position != runsAfter.end()) {
+                    ForEachLiteralReference(array, [&](const std::string &ref) { propagate(ref, position->second); });
+                }
+            }
+        }
+    };
+    settle();
+
+    // A function that no name reached from the entry leads to is run by other means, e.g. by the runtime.
+    // It may run at any time, and so may everything it names
+    bool unreached = false;
+    for (const auto &[name, function] : program.function_table) {
+        if (&function != main && runsAfter.emplace(name, ANY_TIME).second) {
+            unreached = true;
+        }
+    }
+    if (unreached) {
+        settle();
+    }
+
+    for (auto &[name, function] : program.function_table) {
+        auto position = runsAfter.find(name);
+        size_t functionRunsAfter = position == runsAfter.end() ? ANY_TIME : position->second;
+        for (size_t i = 0; i < function.ins.size(); i++) {
+            auto &ins = function.ins[i];
+            if (ins.opcode != panda::pandasm::Opcode::LDLOCALMODULEVAR &&
+                ins.opcode != panda::pandasm::Opcode::WIDE_LDLOCALMODULEVAR) {
+                continue;
+            }
+            auto index = ModuleVariableIndex(ins);
+            auto store = index.has_value() ? stores.find(*index) : stores.end();
+            if (store == stores.end()) {
+                continue;
+            }
+            size_t loadPosition = &function == main ? i + 1 : functionRunsAfter;
+            if (loadPosition <= store->second + 1) {
+                continue;
+            }
+
+            // The hole check following the load now always passes, it is kept to leave the labels untouched
+            const auto &constant = mainIns[store->second - 1];
+            ins.opcode = constant.opcode;
+            ins.regs.clear();
+            ins.ids = constant.ids;
+            ins.imms = constant.imms;
+            foldedLoads_++;
+        }
+    }
+}
+
+void WholeProgramOptimizer::Run(const std::map<std::string, ProgramCache *> &programsInfo,
+                                const std::unordered_map<std::string, std::string> &cacheFiles)
+{
+    // Instructions only name functions and literal arrays of their own record, so every record is a closed world.
+    // A program is optimized only when it is exactly one record
+    for (const auto &[name, cache] : programsInfo) {
+        if (cache->emitted || (cache->needUpdateCache && cacheFiles.find(name) != cacheFiles.end())) {
+            continue;
+        }
+        if (!IsSingleRecordProgram(name, cache->program)) {
+            skippedPrograms_++;
+            continue;
+        }
+        RemoveDeadFunctions(cache->program);
+        PropagateModuleConstants(cache->program);
+    }
+}
+
+void WholeProgramOptimizer::DumpStatistic(std::ostream &out) const
+{
+    out << "Whole program optimization: " << removedFunctions_ << " of " << totalFunctions_ << " functions, "
+        << removedArrays_ << " literal arrays removed, " << foldedLoads_ << " module variable loads folded, "
+        << skippedPrograms_ << " programs skipped" << std::endl;
+}
+}  // namespace panda::es2panda::util
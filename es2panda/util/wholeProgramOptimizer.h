@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ES2PANDA_UTIL_WHOLE_PROGRAM_OPTIMIZER_H
+#define ES2PANDA_UTIL_WHOLE_PROGRAM_OPTIMIZER_H
+
+#include <assembly-program.h>
+#include <macros.h>
+#include <util/programCache.h>
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace panda::es2panda::util {
+/*
+ * Optimizes the programs of a merged abc once all of them are compiled. Calls of the dynamic bytecode go through
+ * values, so the call graph is the graph of names: a function can only run after an instruction or a literal array
+ * naming it was executed. Functions and literal arrays that are not reachable from the module entry are removed,
+ * and local module variables stored once with a constant are replaced by that constant where the store is known
+ * to have happened already. Programs read from an abc file or holding several records are not optimized.
+ */
+class WholeProgramOptimizer {
+public:
+    WholeProgramOptimizer() = default;
+    NO_COPY_SEMANTIC(WholeProgramOptimizer);
+    NO_MOVE_SEMANTIC(WholeProgramOptimizer);
+    ~WholeProgramOptimizer() = default;
+
+    void Run(const std::map<std::string, ProgramCache *> &programsInfo,
+             const std::unordered_map<std::string, std::string> &cacheFiles);
+    void DumpStatistic(std::ostream &out) const;
+
+private:
+    static panda::pandasm::Function *FindMainFunction(panda::pandasm::Program &program);
+    static bool IsSingleRecordProgram(const std::string &fileName, const panda::pandasm::Program &program);
+    static bool IsConstantLoad(panda::pandasm::Opcode opcode);
+    static std::unordered_set<std::string> CollectReferencedArrays(const panda::pandasm::Program &program);
+    static void PruneStrings(panda::pandasm::Program &program);
+
+    void RemoveDeadFunctions(panda::pandasm::Program &program);
+    void PropagateModuleConstants(panda::pandasm::Program &program);
+
+    size_t totalFunctions_ {0};
+    size_t removedFunctions_ {0};
+    size_t removedArrays_ {0};
+    size_t foldedLoads_ {0};
+    size_t skippedPrograms_ {0};
+};
+}  // namespace panda::es2panda::util
+
+#endif
@@ -33,11 +33,9 @@ using mem::MemConfig;
 
 class MemManager {
 public:
-    explicit MemManager()
+    explicit MemManager(uint32_t compilerSizeMb)
     {
-        constexpr auto COMPILER_SIZE = 256_MB;
-
-        MemConfig::Initialize(0, 0, COMPILER_SIZE, 0, 0, 0);
+        MemConfig::Initialize(0, 0, compilerSizeMb * 1_MB, 0, 0, 0);
         PoolManager::Initialize(PoolType::MMAP);
     }
 
@@ -132,6 +130,15 @@ static int Run(int argc, const char **argv)
         return 1;
     }
 
+    // Unchecked bodies can not be lowered, the program is only good for the inspection through the public API
+    if (options->CompilerOptions().checkSignaturesOnly) {
+        std::cerr << "Error: --check-signatures-only is supported by declgen and the public API only" << std::endl;
+        return 1;
+    }
+
+    // The memory space is sized by the options, everything allocated from arenas has to be created after it
+    MemManager mm(options->CompilerMemoryLimit());
+
     Logger::ComponentMask mask {};
     mask.set(Logger::Component::ES2PANDA);
     Logger::InitializeStdLogging(Logger::LevelFromString(options->LogLevel()), mask);
@@ -161,6 +168,5 @@ static int Run(int argc, const char **argv)
 
 int main(int argc, const char **argv)
 {
-    ark::es2panda::aot::MemManager mm;
     return ark::es2panda::aot::Run(argc, argv);
 }
@@ -78,6 +78,21 @@ void CheckExtensionMethod(checker::ETSChecker *checker, ir::ScriptFunction *exte
     CheckExtensionIsShadowedByMethod(checker, classType->AsETSObjectType(), extensionFunc, originalExtensionSigature);
 }
 
+// Bodies of external functions are not checked. In signature-only mode a body is checked only when the return type
+// has to be inferred from it
+static bool IsBodyCheckSkipped(ETSChecker *checker, ir::MethodDefinition *node, ir::ScriptFunction *scriptFunc)
+{
+    if (!checker->IsCheckingSignaturesOnly()) {
+        return scriptFunc->IsExternal();
+    }
+
+    if (node->IsConstructor() || scriptFunc->ReturnTypeAnnotation() != nullptr) {
+        return true;
+    }
+
+    return scriptFunc->IsExternal() && !checker->IsInInferredReturnProgram(scriptFunc);
+}
+
 void DoBodyTypeChecking(ETSChecker *checker, ir::MethodDefinition *node, ir::ScriptFunction *scriptFunc)
 {
     if (scriptFunc->HasBody() && (node->IsNative() || node->IsAbstract() || node->IsDeclare())) {
@@ -90,7 +105,7 @@ void DoBodyTypeChecking(ETSChecker *checker, ir::MethodDefinition *node, ir::Scr
             retType->AsETSObjectType()->GetOriginalBaseType() != checker->GlobalBuiltinPromiseType()) {
             checker->ThrowTypeError("Return type of async function must be 'Promise'.", scriptFunc->Start());
         }
-    } else if (scriptFunc->HasBody() && !scriptFunc->IsExternal()) {
+    } else if (scriptFunc->HasBody() && !IsBodyCheckSkipped(checker, node, scriptFunc)) {
         checker::ScopeContext scopeCtx(checker, scriptFunc->Scope());
         checker::SavedCheckerContext savedContext(checker, checker->Context().Status(),
                                                   checker->Context().ContainingClass());
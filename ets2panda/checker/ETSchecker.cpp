@@ -168,6 +168,7 @@ bool ETSChecker::StartChecker([[maybe_unused]] varbinder::VarBinder *varbinder,
         return false;
     }
 
+    checkSignaturesOnly_ = options.checkSignaturesOnly;
     varbinder->SetGenStdLib(options.compilationMode == CompilationMode::GEN_STD_LIB);
     varbinder->IdentifierAnalysis();
 
@@ -181,7 +182,8 @@ bool ETSChecker::StartChecker([[maybe_unused]] varbinder::VarBinder *varbinder,
         }
     }
 
-    CheckProgram(Program(), true);
+    // Flow analysis needs checked function bodies
+    CheckProgram(Program(), !checkSignaturesOnly_);
     // SUPPRESS_CSA_NEXTLINE(alpha.core.AllocatorETSCheckerHint)
     BuildDynamicCallClass(true);
     // SUPPRESS_CSA_NEXTLINE(alpha.core.AllocatorETSCheckerHint)
@@ -202,9 +204,24 @@ bool ETSChecker::StartChecker([[maybe_unused]] varbinder::VarBinder *varbinder,
         std::cout << Program()->Dump() << std::endl;
     }
 
+    LOG(DEBUG, ES2PANDA) << "Generic instantiations: " << instantiationStatistics_.lazyInstantiations
+                         << " lazy, " << instantiationStatistics_.fullInstantiations << " full, "
+                         << instantiationStatistics_.copiedProperties << " properties copied";
+
     return true;
 }
 
+void ETSChecker::AddInferredReturnProgram(const parser::Program *program)
+{
+    inferredReturnPrograms_.insert(program->Ast());
+}
+
+// A body may be checked while another program is checked, so the program is found by the root of the node
+bool ETSChecker::IsInInferredReturnProgram(const ir::AstNode *node) const
+{
+    return inferredReturnPrograms_.count(node->GetTopStatement()) != 0;
+}
+
 void ETSChecker::CheckProgram(parser::Program *program, bool runAnalysis)
 {
     auto *savedProgram = Program();
@@ -46,6 +46,21 @@ using DynamicLambdaObjectSignatureMap = ArenaUnorderedMap<std::string, Signature
 using FunctionalInterfaceMap = ArenaUnorderedMap<util::StringView, ETSObjectType *>;
 using TypeMapping = ArenaUnorderedMap<Type const *, Type *>;
 using DynamicCallNamesMap = ArenaMap<const ArenaVector<util::StringView>, uint32_t>;
+// For every method name and erased arity: the types declaring such a method, ranked in search order (class itself,
+// its interfaces, then the superclass chain)
+using MethodTableSites = ArenaVector<std::pair<size_t, ETSObjectType *>>;
+using MethodTable = ArenaUnorderedMap<util::StringView, ArenaMap<size_t, MethodTableSites>>;
+using MethodTableMap = ArenaUnorderedMap<const ETSObjectType *, MethodTable>;
+// Types whose cached method table was built from the methods or the table of the key type
+using MethodTableDependents = ArenaUnorderedMap<const ETSObjectType *, ArenaVector<const ETSObjectType *>>;
+// Candidate identities (declaration, owner and parameter types of each signature) to the index of the chosen one
+using MostSpecificSignatureCache = ArenaMap<const ArenaVector<const void *>, size_t>;
+
+struct GenericInstantiationStatistics {
+    size_t lazyInstantiations {0};
+    size_t fullInstantiations {0};
+    size_t copiedProperties {0};
+};
 
 class ETSChecker final : public Checker {
 public:
@@ -58,6 +73,9 @@ public:
           globalArraySignatures_(Allocator()->Adapter()),
           primitiveWrappers_(Allocator()),
           cachedComputedAbstracts_(Allocator()->Adapter()),
+          cachedMethodTables_(Allocator()->Adapter()),
+          methodTableDependents_(Allocator()->Adapter()),
+          mostSpecificSignatureCache_(Allocator()->Adapter()),
           dynamicCallIntrinsics_(Allocator()->Adapter()),
           dynamicNewIntrinsics_(Allocator()->Adapter()),
           dynamicLambdaSignatureCache_(Allocator()->Adapter()),
@@ -334,6 +352,9 @@ public:
     Signature *ChooseMostSpecificSignature(ArenaVector<Signature *> &signatures,
                                            const std::vector<bool> &argTypeInferenceRequired,
                                            const lexer::SourcePosition &pos, size_t argumentsSize = ULONG_MAX);
+    Signature *FindMostSpecificSignature(const ArenaVector<Signature *> &signatures,
+                                         const std::vector<bool> &argTypeInferenceRequired,
+                                         const lexer::SourcePosition &pos, size_t paramCount, size_t argumentsSize);
     Signature *ResolveCallExpression(ArenaVector<Signature *> &signatures,
                                      const ir::TSTypeParameterInstantiation *typeArguments,
                                      const ArenaVector<ir::Expression *> &arguments, const lexer::SourcePosition &pos);
@@ -356,6 +377,24 @@ public:
                                  const ir::MethodDefinition *currentFunc);
     Signature *AdjustForTypeParameters(Signature *source, Signature *target);
     void ThrowOverrideError(Signature *signature, Signature *overriddenSignature, const OverrideErrorCode &errorCode);
+    GenericInstantiationStatistics &GetInstantiationStatistics()
+    {
+        return instantiationStatistics_;
+    }
+
+    bool IsCheckingSignaturesOnly() const
+    {
+        return checkSignaturesOnly_;
+    }
+
+    // Bodies in external sources are not checked, so in signature-only mode the return types of their functions
+    // are inferred only for the programs added here
+    void AddInferredReturnProgram(const parser::Program *program);
+    bool IsInInferredReturnProgram(const ir::AstNode *node) const;
+
+    const MethodTable &GetMethodTable(ETSObjectType *type);
+    void InvalidateMethodTables(const ETSObjectType *type);
+    void AddMethodProperty(const ETSObjectType *type, varbinder::LocalVariable *method, bool isStatic);
     void CheckOverride(Signature *signature);
     bool CheckOverride(Signature *signature, ETSObjectType *site);
     OverrideErrorCode CheckOverride(Signature *signature, Signature *other);
@@ -766,6 +805,12 @@ private:
     GlobalArraySignatureMap globalArraySignatures_;
     PrimitiveWrappers primitiveWrappers_;
     ComputedAbstracts cachedComputedAbstracts_;
+    MethodTableMap cachedMethodTables_;
+    MethodTableDependents methodTableDependents_;
+    MostSpecificSignatureCache mostSpecificSignatureCache_;
+    GenericInstantiationStatistics instantiationStatistics_ {};
+    bool checkSignaturesOnly_ {false};
+    std::unordered_set<const ir::BlockStatement *> inferredReturnPrograms_;
     DynamicCallIntrinsicsMap dynamicCallIntrinsics_;
     DynamicCallIntrinsicsMap dynamicNewIntrinsics_;
     DynamicLambdaObjectSignatureMap dynamicLambdaSignatureCache_;
@@ -493,14 +493,11 @@ ir::ClassStaticBlock *ETSChecker::CreateDynamicModuleClassInitializer(
 }
 
 template <bool IS_STATIC>
-static void AddMethodToClass(varbinder::ClassScope *classScope, varbinder::Variable *methodVar, Signature *signature)
+static void AddMethodToClass(ETSChecker *checker, varbinder::ClassScope *classScope, varbinder::Variable *methodVar,
+                             Signature *signature)
 {
     auto *classType = classScope->Node()->AsClassDeclaration()->Definition()->TsType()->AsETSObjectType();
-    if constexpr (IS_STATIC) {
-        classType->AddProperty<PropertyType::STATIC_METHOD>(methodVar->AsLocalVariable());
-    } else {
-        classType->AddProperty<PropertyType::INSTANCE_METHOD>(methodVar->AsLocalVariable());
-    }
+    checker->AddMethodProperty(classType, methodVar->AsLocalVariable(), IS_STATIC);
     signature->SetOwner(classType);
 }
 
@@ -568,7 +565,7 @@ ir::MethodDefinition *ETSChecker::CreateClassMethod(varbinder::ClassScope *class
     func->Id()->SetVariable(var);
     method->Id()->SetVariable(var);
 
-    AddMethodToClass<IS_STATIC>(classScope, var, signature);
+    AddMethodToClass<IS_STATIC>(this, classScope, var, signature);
 
     return method;
 }
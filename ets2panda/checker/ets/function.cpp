@@ -443,6 +443,18 @@ bool IsSignatureAccessible(Signature *sig, ETSObjectType *containingClass, TypeR
     return false;
 }
 
+// Without type parameters the arity of a signature is known up front, so a mismatching candidate can be dropped
+// before any substitution or argument check is made for it.
+static bool HasIncompatibleArity(Signature *sig, const ir::TSTypeParameterInstantiation *typeArguments,
+                                 std::size_t argumentCount)
+{
+    if (typeArguments != nullptr || !sig->GetSignatureInfo()->typeParams.empty()) {
+        return false;
+    }
+
+    return argumentCount < sig->MinArgCount() || (argumentCount > sig->MinArgCount() && sig->RestVar() == nullptr);
+}
+
 ArenaVector<Signature *> ETSChecker::CollectSignatures(ArenaVector<Signature *> &signatures,
                                                        const ir::TSTypeParameterInstantiation *typeArguments,
                                                        const ArenaVector<ir::Expression *> &arguments,
@@ -452,8 +464,21 @@ ArenaVector<Signature *> ETSChecker::CollectSignatures(ArenaVector<Signature *>
     std::vector<bool> argTypeInferenceRequired = FindTypeInferenceArguments(arguments);
     Signature *notVisibleSignature = nullptr;
 
-    auto collectSignatures = [&](TypeRelationFlag relationFlags) {
+    // A single signature is always validated to report the most specific error message.
+    ArenaVector<Signature *> candidates(Allocator()->Adapter());
+    if (signatures.size() > 1) {
+        candidates.reserve(signatures.size());
         for (auto *sig : signatures) {
+            if (!HasIncompatibleArity(sig, typeArguments, arguments.size())) {
+                candidates.push_back(sig);
+            }
+        }
+    } else {
+        candidates = signatures;
+    }
+
+    auto collectSignatures = [&](TypeRelationFlag relationFlags) {
+        for (auto *sig : candidates) {
             if (notVisibleSignature != nullptr &&
                 !IsSignatureAccessible(sig, Context().ContainingClass(), Relation())) {
                 continue;
@@ -566,6 +591,28 @@ Signature *ETSChecker::ValidateSignatures(ArenaVector<Signature *> &signatures,
     return nullptr;
 }
 
+// Substituted signatures are new objects for every call, but object, array and primitive types are interned, so
+// the declaration, owner and parameter types identify a candidate across call sites.
+static bool ComputeMostSpecificSignatureKey(const ArenaVector<Signature *> &signatures, size_t paramCount,
+                                            ArenaVector<const void *> *key)
+{
+    key->reserve(signatures.size() * (paramCount + 2U));
+    for (auto *const sig : signatures) {
+        key->push_back(sig->Function());
+        key->push_back(sig->Owner());
+        for (size_t i = 0; i < paramCount; ++i) {
+            auto *const paramType = sig->Params().at(i)->TsType();
+            if (!paramType->IsETSObjectType() && !paramType->IsETSArrayType() && !paramType->IsETSTypeParameter() &&
+                !paramType->HasTypeFlag(TypeFlag::ETS_PRIMITIVE)) {
+                return false;
+            }
+            key->push_back(paramType);
+        }
+    }
+
+    return true;
+}
+
 Signature *ETSChecker::ChooseMostSpecificSignature(ArenaVector<Signature *> &signatures,
                                                    const std::vector<bool> &argTypeInferenceRequired,
                                                    const lexer::SourcePosition &pos, size_t argumentsSize)
@@ -586,6 +633,35 @@ Signature *ETSChecker::ChooseMostSpecificSignature(ArenaVector<Signature *> &sig
         return signatures.front();
     }
 
+    // Without pending argument inference the result only depends on the declarations, owners and parameter types of
+    // the candidates, so it is shared by every call site resolving to such a set of signatures.
+    ArenaVector<const void *> cacheKey(Allocator()->Adapter());
+    const bool cacheable = argumentsSize == ULONG_MAX &&
+                           std::find(argTypeInferenceRequired.begin(), argTypeInferenceRequired.end(), true) ==
+                               argTypeInferenceRequired.end() &&
+                           ComputeMostSpecificSignatureKey(signatures, paramCount, &cacheKey);
+    if (cacheable) {
+        if (auto cached = mostSpecificSignatureCache_.find(cacheKey); cached != mostSpecificSignatureCache_.end()) {
+            return cached->second < signatures.size() ? signatures[cached->second] : nullptr;
+        }
+    }
+
+    auto *mostSpecificSignature =
+        FindMostSpecificSignature(signatures, argTypeInferenceRequired, pos, paramCount, argumentsSize);
+    if (cacheable) {
+        auto found = std::find(signatures.begin(), signatures.end(), mostSpecificSignature);
+        mostSpecificSignatureCache_.emplace(std::move(cacheKey),
+                                            static_cast<size_t>(std::distance(signatures.begin(), found)));
+    }
+
+    return mostSpecificSignature;
+}
+
+Signature *ETSChecker::FindMostSpecificSignature(const ArenaVector<Signature *> &signatures,
+                                                 const std::vector<bool> &argTypeInferenceRequired,
+                                                 const lexer::SourcePosition &pos, size_t paramCount,
+                                                 size_t argumentsSize)
+{
     // Collect which signatures are most specific for each parameter.
     ArenaMultiMap<size_t /* parameter index */, Signature *> bestSignaturesForParameter(Allocator()->Adapter());
 
@@ -1192,52 +1268,177 @@ void ETSChecker::ThrowOverrideError(Signature *signature, Signature *overriddenS
                    signature->Function()->Start());
 }
 
-bool ETSChecker::CheckOverride(Signature *signature, ETSObjectType *site)
+static void CollectOverrideSites(ETSObjectType *const type, ArenaVector<ETSObjectType *> *const sites)
 {
-    auto *target = site->GetProperty(signature->Function()->Id()->Name(), PropertySearchFlags::SEARCH_METHOD);
-    bool isOverridingAnySignature = false;
+    if (std::find(sites->begin(), sites->end(), type) != sites->end()) {
+        return;
+    }
+
+    sites->push_back(type);
 
-    if (target == nullptr) {
-        return isOverridingAnySignature;
+    for (auto *const interface : type->Interfaces()) {
+        CollectOverrideSites(interface, sites);
     }
+}
 
-    bool suitableSignatureFound = false;
-    for (auto *it : target->TsType()->AsETSFunctionType()->CallSignatures()) {
-        auto *itSubst = AdjustForTypeParameters(signature, it);
+// Signatures with mandatory parameters only are compatible with each other only if their arities are equal; any
+// signature with default or rest parameters may be compatible with every arity
+static constexpr size_t ANY_METHOD_ARITY = std::numeric_limits<size_t>::max();
 
-        if (itSubst == nullptr) {
-            continue;
-        }
+static size_t MethodTableArity(Signature *const signature)
+{
+    if (signature->RestVar() != nullptr) {
+        return ANY_METHOD_ARITY;
+    }
 
-        if (itSubst->HasSignatureFlag(SignatureFlags::ABSTRACT) || site->HasObjectFlag(ETSObjectFlags::INTERFACE)) {
-            if (site->HasObjectFlag(ETSObjectFlags::INTERFACE)) {
-                CheckThrowMarkers(itSubst, signature);
+    if (signature->Function() != nullptr) {
+        for (auto *const param : signature->Function()->Params()) {
+            if (param->IsETSParameterExpression() && param->AsETSParameterExpression()->IsDefault()) {
+                return ANY_METHOD_ARITY;
             }
-            if ((itSubst->Function()->IsSetter() && !signature->Function()->IsSetter()) ||
-                (itSubst->Function()->IsGetter() && !signature->Function()->IsGetter())) {
+        }
+    }
+
+    return signature->Params().size();
+}
+
+// The table of a type is built once from its own methods, the methods of its interfaces and the table of its
+// superclass, so override checking does not need to walk the whole hierarchy for every method.
+const MethodTable &ETSChecker::GetMethodTable(ETSObjectType *type)
+{
+    auto cached = cachedMethodTables_.find(type);
+    if (cached != cachedMethodTables_.end()) {
+        return cached->second;
+    }
+
+    MethodTable table(Allocator()->Adapter());
+    auto const addSite = [this, &table](const util::StringView &name, size_t arity, size_t rank, ETSObjectType *site) {
+        auto &byArity = table.try_emplace(name, Allocator()->Adapter()).first->second;
+        auto &sites = byArity.try_emplace(arity, Allocator()->Adapter()).first->second;
+        if (std::none_of(sites.begin(), sites.end(), [site](const auto &entry) { return entry.second == site; })) {
+            sites.emplace_back(rank, site);
+        }
+    };
+
+    ArenaVector<ETSObjectType *> ownSites(Allocator()->Adapter());
+    CollectOverrideSites(type, &ownSites);
+
+    auto const addDependent = [this, type](const ETSObjectType *base) {
+        auto &dependents = methodTableDependents_.try_emplace(base, Allocator()->Adapter()).first->second;
+        if (std::find(dependents.begin(), dependents.end(), type) == dependents.end()) {
+            dependents.push_back(type);
+        }
+    };
+    std::for_each(std::next(ownSites.begin()), ownSites.end(), addDependent);
+    if (type->SuperType() != nullptr) {
+        addDependent(type->SuperType());
+    }
+
+    for (size_t rank = 0; rank < ownSites.size(); rank++) {
+        auto *const site = ownSites[rank];
+        for (auto *const method : site->Methods()) {
+            auto *const methodType = method->TsType();
+            if (methodType == nullptr || !methodType->IsETSFunctionType()) {
+                addSite(method->Name(), ANY_METHOD_ARITY, rank, site);
                 continue;
             }
+            for (auto *const signature : methodType->AsETSFunctionType()->CallSignatures()) {
+                addSite(method->Name(), MethodTableArity(signature), rank, site);
+            }
         }
-        if (!IsMethodOverridesOther(itSubst, signature)) {
-            continue;
-        }
+    }
 
-        auto errorCode = CheckOverride(signature, itSubst);
-        if (errorCode == OverrideErrorCode::NO_ERROR) {
-            suitableSignatureFound = true;
-        } else if (!suitableSignatureFound) {
-            ThrowOverrideError(signature, it, errorCode);
+    if (type->SuperType() != nullptr) {
+        for (const auto &[name, byArity] : GetMethodTable(type->SuperType())) {
+            for (const auto &[arity, inheritedSites] : byArity) {
+                for (const auto &[rank, site] : inheritedSites) {
+                    addSite(name, arity, ownSites.size() + rank, site);
+                }
+            }
         }
+    }
+
+    return cachedMethodTables_.emplace(type, std::move(table)).first->second;
+}
+
+// Drops the table of the type and of every type whose table was built from it: its subclasses and the types
+// implementing or extending it as an interface
+void ETSChecker::InvalidateMethodTables(const ETSObjectType *type)
+{
+    cachedMethodTables_.erase(type);
+
+    auto found = methodTableDependents_.find(type);
+    if (found == methodTableDependents_.end()) {
+        return;
+    }
+
+    auto dependents = std::move(found->second);
+    methodTableDependents_.erase(found);
+    for (const auto *dependent : dependents) {
+        InvalidateMethodTables(dependent);
+    }
+}
+
+void ETSChecker::AddMethodProperty(const ETSObjectType *type, varbinder::LocalVariable *method, bool isStatic)
+{
+    if (isStatic) {
+        type->AddProperty<PropertyType::STATIC_METHOD>(method);
+    } else {
+        type->AddProperty<PropertyType::INSTANCE_METHOD>(method);
+    }
+    InvalidateMethodTables(type);
+}
+
+bool ETSChecker::CheckOverride(Signature *signature, ETSObjectType *site)
+{
+    const auto &name = signature->Function()->Id()->Name();
+    bool isOverridingAnySignature = false;
+    bool suitableSignatureFound = false;
 
-        if (signature->Owner()->HasObjectFlag(ETSObjectFlags::INTERFACE) &&
-            Relation()->IsIdenticalTo(itSubst->Owner(), GlobalETSObjectType()) &&
-            !itSubst->HasSignatureFlag(SignatureFlags::PRIVATE)) {
-            ThrowTypeError("Cannot override non-private method of the class Object from an interface.",
-                           signature->Function()->Start());
+    for (auto *const target : {site->GetOwnProperty<PropertyType::STATIC_METHOD>(name),
+                               site->GetOwnProperty<PropertyType::INSTANCE_METHOD>(name)}) {
+        if (target == nullptr) {
+            continue;
         }
 
-        isOverridingAnySignature = true;
-        it->AddSignatureFlag(SignatureFlags::VIRTUAL);
+        for (auto *it : target->TsType()->AsETSFunctionType()->CallSignatures()) {
+            auto *itSubst = AdjustForTypeParameters(signature, it);
+
+            if (itSubst == nullptr) {
+                continue;
+            }
+
+            if (itSubst->HasSignatureFlag(SignatureFlags::ABSTRACT) ||
+                site->HasObjectFlag(ETSObjectFlags::INTERFACE)) {
+                if (site->HasObjectFlag(ETSObjectFlags::INTERFACE)) {
+                    CheckThrowMarkers(itSubst, signature);
+                }
+                if ((itSubst->Function()->IsSetter() && !signature->Function()->IsSetter()) ||
+                    (itSubst->Function()->IsGetter() && !signature->Function()->IsGetter())) {
+                    continue;
+                }
+            }
+            if (!IsMethodOverridesOther(itSubst, signature)) {
+                continue;
+            }
+
+            auto errorCode = CheckOverride(signature, itSubst);
+            if (errorCode == OverrideErrorCode::NO_ERROR) {
+                suitableSignatureFound = true;
+            } else if (!suitableSignatureFound) {
+                ThrowOverrideError(signature, it, errorCode);
+            }
+
+            if (signature->Owner()->HasObjectFlag(ETSObjectFlags::INTERFACE) &&
+                Relation()->IsIdenticalTo(itSubst->Owner(), GlobalETSObjectType()) &&
+                !itSubst->HasSignatureFlag(SignatureFlags::PRIVATE)) {
+                ThrowTypeError("Cannot override non-private method of the class Object from an interface.",
+                               signature->Function()->Start());
+            }
+
+            isOverridingAnySignature = true;
+            it->AddSignatureFlag(SignatureFlags::VIRTUAL);
+        }
     }
 
     return isOverridingAnySignature;
@@ -1252,19 +1453,30 @@ void ETSChecker::CheckOverride(Signature *signature)
         return;
     }
 
-    for (auto *const interface : owner->Interfaces()) {
-        isOverriding |= CheckInterfaceOverride(this, interface, signature);
-    }
-
-    ETSObjectType *iter = owner->SuperType();
-    while (iter != nullptr) {
-        isOverriding |= CheckOverride(signature, iter);
-
-        for (auto *const interface : iter->Interfaces()) {
-            isOverriding |= CheckInterfaceOverride(this, interface, signature);
+    const auto &methodTable = GetMethodTable(owner);
+    if (auto found = methodTable.find(signature->Function()->Id()->Name()); found != methodTable.end()) {
+        auto const arity = MethodTableArity(signature);
+        MethodTableSites candidates(Allocator()->Adapter());
+        for (const auto &[siteArity, sites] : found->second) {
+            if (arity == ANY_METHOD_ARITY || siteArity == ANY_METHOD_ARITY || siteArity == arity) {
+                candidates.insert(candidates.end(), sites.begin(), sites.end());
+                continue;
+            }
+            // Throw markers of interface methods are checked against every signature of the same name
+            std::copy_if(sites.begin(), sites.end(), std::back_inserter(candidates),
+                         [](const auto &entry) { return entry.second->HasObjectFlag(ETSObjectFlags::INTERFACE); });
         }
+        std::stable_sort(candidates.begin(), candidates.end(),
+                  [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
 
-        iter = iter->SuperType();
+        ArenaVector<ETSObjectType *> checked(Allocator()->Adapter());
+        for (const auto &[rank, site] : candidates) {
+            if (site == owner || std::find(checked.begin(), checked.end(), site) != checked.end()) {
+                continue;
+            }
+            checked.push_back(site);
+            isOverriding |= CheckOverride(signature, site);
+        }
     }
 
     if (!isOverriding && signature->Function()->IsOverride()) {
@@ -1650,8 +1862,7 @@ void ETSChecker::ResolveLambdaObjectInvoke(ir::ClassDefinition *lambdaObject, ir
     invokeFunc->SetSignature(invokeSignature);
     invokeFunc->Id()->Variable()->SetTsType(invokeType);
     VarBinder()->AsETSBinder()->BuildFunctionName(invokeFunc);
-    lambdaObjectType->AddProperty<checker::PropertyType::INSTANCE_METHOD>(
-        invokeFunc->Id()->Variable()->AsLocalVariable());
+    AddMethodProperty(lambdaObjectType, invokeFunc->Id()->Variable()->AsLocalVariable(), false);
 
     if (invokeFunc->IsAsyncFunc()) {
         return;
@@ -1927,12 +2138,7 @@ void ETSChecker::ResolveProxyMethod(ir::ClassDefinition *const classDefinition,
     signature->SetOwner(currentClassType);
 
     // Add the proxy method to the current class methods
-    auto *const variable = func->Id()->Variable()->AsLocalVariable();
-    if (isStatic) {
-        currentClassType->AddProperty<checker::PropertyType::STATIC_METHOD>(variable);
-    } else {
-        currentClassType->AddProperty<checker::PropertyType::INSTANCE_METHOD>(variable);
-    }
+    AddMethodProperty(currentClassType, func->Id()->Variable()->AsLocalVariable(), isStatic);
     varbinder->BuildFunctionName(func);
 
     if (lambda->Function()->IsAsyncFunc()) {
@@ -2808,8 +3014,7 @@ void ETSChecker::ResolveLambdaObjectInvoke(ir::ClassDefinition *lambdaObject, Si
     invokeFunc->SetSignature(invokeSignature);
     invokeFunc->Id()->Variable()->SetTsType(invokeType);
     VarBinder()->AsETSBinder()->BuildFunctionName(invokeFunc);
-    lambdaObjectType->AddProperty<checker::PropertyType::INSTANCE_METHOD>(
-        invokeFunc->Id()->Variable()->AsLocalVariable());
+    AddMethodProperty(lambdaObjectType, invokeFunc->Id()->Variable()->AsLocalVariable(), false);
 
     // Fill out the type information for the body of the invoke function
     ResolveLambdaObjectInvokeFuncBody(lambdaObject, signatureRef, ifaceOverride);
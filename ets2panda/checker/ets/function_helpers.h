@@ -228,18 +228,6 @@ static bool HasSameAssemblySignature(ETSFunctionType *func1, ETSFunctionType *fu
     return false;
 }
 
-static bool CheckInterfaceOverride(ETSChecker *const checker, ETSObjectType *const interface,
-                                   Signature *const signature)
-{
-    bool isOverriding = checker->CheckOverride(signature, interface);
-
-    for (auto *const superInterface : interface->Interfaces()) {
-        isOverriding |= CheckInterfaceOverride(checker, superInterface, signature);
-    }
-
-    return isOverriding;
-}
-
 static varbinder::Scope *NodeScope(ir::AstNode *ast)
 {
     if (ast->IsBlockStatement()) {
@@ -1114,7 +1114,7 @@ void ETSChecker::SetPropertiesForModuleObject(checker::ETSObjectType *moduleObjT
     for (auto [_, var] : res->second.front()->GlobalClassScope()->StaticMethodScope()->Bindings()) {
         (void)_;
         if (var->AsLocalVariable()->Declaration()->Node()->IsExported()) {
-            moduleObjType->AddProperty<checker::PropertyType::STATIC_METHOD>(var->AsLocalVariable());
+            AddMethodProperty(moduleObjType, var->AsLocalVariable(), true);
         }
     }
 
@@ -2144,7 +2144,7 @@ void ETSChecker::GenerateGetterSetterPropertyAndMethod(ir::ClassProperty *origin
     getter->SetParent(classDef);
     getter->TsType()->AddTypeFlag(TypeFlag::GETTER);
     getter->Variable()->SetTsType(getter->TsType());
-    classType->AddProperty<checker::PropertyType::INSTANCE_METHOD>(getter->Variable()->AsLocalVariable());
+    AddMethodProperty(classType, getter->Variable()->AsLocalVariable(), false);
 
     auto *const methodScope = scope->InstanceMethodScope();
     auto name = getter->Key()->AsIdentifier()->Name();
@@ -2161,7 +2161,7 @@ void ETSChecker::GenerateGetterSetterPropertyAndMethod(ir::ClassProperty *origin
         setter->TsType()->AddTypeFlag(TypeFlag::SETTER);
         getter->Variable()->TsType()->AsETSFunctionType()->AddCallSignature(
             setter->TsType()->AsETSFunctionType()->CallSignatures()[0]);
-        classType->AddProperty<checker::PropertyType::INSTANCE_METHOD>(setter->Variable()->AsLocalVariable());
+        AddMethodProperty(classType, setter->Variable()->AsLocalVariable(), false);
 
         getter->AddOverload(setter);
     }
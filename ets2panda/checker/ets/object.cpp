@@ -403,7 +403,7 @@ static void ResolveDeclaredMethodsOfObject(ETSChecker *checker, const ETSObjectT
         it->SetTsType(funcType);
         funcType->SetVariable(it);
         method->SetTsType(funcType);
-        type->AddProperty<PropertyType::INSTANCE_METHOD>(it->AsLocalVariable());
+        checker->AddMethodProperty(type, it->AsLocalVariable(), false);
     }
 
     for (auto &[_, it] : scope->StaticMethodScope()->Bindings()) {
@@ -435,7 +435,7 @@ static void ResolveDeclaredMethodsOfObject(ETSChecker *checker, const ETSObjectT
             continue;
         }
 
-        type->AddProperty<PropertyType::STATIC_METHOD>(it->AsLocalVariable());
+        checker->AddMethodProperty(type, it->AsLocalVariable(), true);
     }
 }
 
@@ -1627,7 +1627,7 @@ void ETSChecker::AddElementsToModuleObject(ETSObjectType *moduleObj, const util:
         }
 
         if (var->HasFlag(varbinder::VariableFlags::METHOD)) {
-            moduleObj->AddProperty<checker::PropertyType::STATIC_METHOD>(var->AsLocalVariable());
+            AddMethodProperty(moduleObj, var->AsLocalVariable(), true);
         } else if (var->HasFlag(varbinder::VariableFlags::PROPERTY)) {
             moduleObj->AddProperty<checker::PropertyType::STATIC_FIELD>(var->AsLocalVariable());
         } else {
@@ -888,47 +888,79 @@ void ETSObjectType::InstantiateProperties() const
 
     ASSERT(!propertiesInstantiated_);
     checker->ResolveDeclaredMembersOfObject(this);
+    checker->GetInstantiationStatistics().fullInstantiations++;
 
     for (auto *const it : baseType_->ConstructSignatures()) {
         auto *newSig = it->Substitute(relation_, substitution_);
         constructSignatures_.push_back(newSig);
     }
 
-    for (auto const &[_, prop] : baseType_->InstanceFields()) {
-        (void)_;
-        auto *copiedProp = CopyPropertyWithTypeArguments(prop, relation_, substitution_);
-        properties_[static_cast<size_t>(PropertyType::INSTANCE_FIELD)].emplace(prop->Name(), copiedProp);
-    }
+    // Members already materialized by name lookups are kept, so the variables handed out stay valid
+    auto const copyProperties = [this, checker](PropertyType type, const PropertyMap &baseProperties) {
+        auto &properties = properties_[static_cast<size_t>(type)];
+        for (auto const &[name, prop] : baseProperties) {
+            if (properties.find(name) != properties.end()) {
+                continue;
+            }
+            properties.emplace(name, CopyPropertyWithTypeArguments(prop, relation_, substitution_));
+            checker->GetInstantiationStatistics().copiedProperties++;
+        }
+    };
 
-    for (auto const &[_, prop] : baseType_->StaticFields()) {
-        (void)_;
-        auto *copiedProp = CopyPropertyWithTypeArguments(prop, relation_, substitution_);
-        properties_[static_cast<size_t>(PropertyType::STATIC_FIELD)].emplace(prop->Name(), copiedProp);
-    }
+    copyProperties(PropertyType::INSTANCE_FIELD, baseType_->InstanceFields());
+    copyProperties(PropertyType::STATIC_FIELD, baseType_->StaticFields());
+    copyProperties(PropertyType::INSTANCE_METHOD, baseType_->InstanceMethods());
+    copyProperties(PropertyType::STATIC_METHOD, baseType_->StaticMethods());
+    copyProperties(PropertyType::INSTANCE_DECL, baseType_->InstanceDecls());
+    copyProperties(PropertyType::STATIC_DECL, baseType_->StaticDecls());
+}
 
-    for (auto const &[_, prop] : baseType_->InstanceMethods()) {
-        (void)_;
-        auto *copiedProp = CopyPropertyWithTypeArguments(prop, relation_, substitution_);
-        properties_[static_cast<size_t>(PropertyType::INSTANCE_METHOD)].emplace(prop->Name(), copiedProp);
+static varbinder::LocalVariable *GetOwnPropertyOfType(const ETSObjectType *type, PropertyType propertyType,
+                                                      const util::StringView &name)
+{
+    switch (propertyType) {
+        case PropertyType::INSTANCE_METHOD:
+            return type->GetOwnProperty<PropertyType::INSTANCE_METHOD>(name);
+        case PropertyType::INSTANCE_FIELD:
+            return type->GetOwnProperty<PropertyType::INSTANCE_FIELD>(name);
+        case PropertyType::INSTANCE_DECL:
+            return type->GetOwnProperty<PropertyType::INSTANCE_DECL>(name);
+        case PropertyType::STATIC_METHOD:
+            return type->GetOwnProperty<PropertyType::STATIC_METHOD>(name);
+        case PropertyType::STATIC_FIELD:
+            return type->GetOwnProperty<PropertyType::STATIC_FIELD>(name);
+        case PropertyType::STATIC_DECL:
+            return type->GetOwnProperty<PropertyType::STATIC_DECL>(name);
+        default:
+            UNREACHABLE();
     }
+}
 
-    for (auto const &[_, prop] : baseType_->StaticMethods()) {
-        (void)_;
-        auto *copiedProp = CopyPropertyWithTypeArguments(prop, relation_, substitution_);
-        properties_[static_cast<size_t>(PropertyType::STATIC_METHOD)].emplace(prop->Name(), copiedProp);
+varbinder::LocalVariable *ETSObjectType::InstantiateProperty(PropertyType type, const util::StringView &name) const
+{
+    auto &properties = properties_[static_cast<size_t>(type)];
+    if (auto found = properties.find(name); found != properties.end()) {
+        return found->second;
     }
 
-    for (auto const &[_, prop] : baseType_->InstanceDecls()) {
-        (void)_;
-        auto *copiedProp = CopyPropertyWithTypeArguments(prop, relation_, substitution_);
-        properties_[static_cast<size_t>(PropertyType::INSTANCE_DECL)].emplace(prop->Name(), copiedProp);
+    ASSERT(relation_ != nullptr);
+    auto *checker = relation_->GetChecker()->AsETSChecker();
+
+    if (!lazyInstantiationStarted_) {
+        checker->ResolveDeclaredMembersOfObject(this);
+        lazyInstantiationStarted_ = true;
+        checker->GetInstantiationStatistics().lazyInstantiations++;
     }
 
-    for (auto const &[_, prop] : baseType_->StaticDecls()) {
-        (void)_;
-        auto *copiedProp = CopyPropertyWithTypeArguments(prop, relation_, substitution_);
-        properties_[static_cast<size_t>(PropertyType::STATIC_DECL)].emplace(prop->Name(), copiedProp);
+    auto *baseProp = GetOwnPropertyOfType(baseType_, type, name);
+    if (baseProp == nullptr) {
+        return nullptr;
     }
+
+    auto *copiedProp = CopyPropertyWithTypeArguments(baseProp, relation_, substitution_);
+    checker->GetInstantiationStatistics().copiedProperties++;
+    // Substituting the property type may have already materialized the same member
+    return properties.emplace(name, copiedProp).first->second;
 }
 
 void ETSObjectType::DebugInfoTypeFromName(std::stringstream &ss, util::StringView asmName)
@@ -60,12 +60,14 @@ public:
 
     void AddConstructSignature(Signature *signature)
     {
+        CompleteLazyInstantiation();
         constructSignatures_.push_back(signature);
         propertiesInstantiated_ = true;
     }
 
     void AddConstructSignature(const ArenaVector<Signature *> &signatures) const
     {
+        CompleteLazyInstantiation();
         constructSignatures_.insert(constructSignatures_.end(), signatures.begin(), signatures.end());
         propertiesInstantiated_ = true;
     }
@@ -321,6 +323,10 @@ public:
     template <PropertyType TYPE>
     varbinder::LocalVariable *GetOwnProperty(const util::StringView &name) const
     {
+        if (!propertiesInstantiated_ && IsLazilyInstantiated()) {
+            return InstantiateProperty(TYPE, name);
+        }
+
         EnsurePropertiesInstantiated();
         auto found = properties_[static_cast<size_t>(TYPE)].find(name);
         if (found != properties_[static_cast<size_t>(TYPE)].end()) {
@@ -332,6 +338,7 @@ public:
     template <PropertyType TYPE>
     void AddProperty(varbinder::LocalVariable *prop) const
     {
+        CompleteLazyInstantiation();
         properties_[static_cast<size_t>(TYPE)].emplace(prop->Name(), prop);
         propertiesInstantiated_ = true;
     }
@@ -339,6 +346,7 @@ public:
     template <PropertyType TYPE>
     void RemoveProperty(varbinder::LocalVariable *prop)
     {
+        CompleteLazyInstantiation();
         properties_[static_cast<size_t>(TYPE)].erase(prop->Name());
         propertiesInstantiated_ = true;
     }
@@ -448,6 +456,19 @@ private:
             propertiesInstantiated_ = true;
         }
     }
+
+    /* Members of a generic instantiation are copied from its base one by one, as they are looked up by name. */
+    bool IsLazilyInstantiated() const
+    {
+        return baseType_ != nullptr && baseType_ != this && IsGeneric();
+    }
+    varbinder::LocalVariable *InstantiateProperty(PropertyType type, const util::StringView &name) const;
+    void CompleteLazyInstantiation() const
+    {
+        if (lazyInstantiationStarted_) {
+            EnsurePropertiesInstantiated();
+        }
+    }
     ArenaMap<util::StringView, const varbinder::LocalVariable *> CollectAllProperties() const;
     bool CastWideningNarrowing(TypeRelation *relation, Type *target, TypeFlag unboxFlags, TypeFlag wideningFlags,
                                TypeFlag narrowingFlags);
@@ -486,6 +507,7 @@ private:
     TypeRelation *relation_ = nullptr;
     const Substitution *substitution_ = nullptr;
     mutable bool propertiesInstantiated_ = false;
+    mutable bool lazyInstantiationStarted_ = false;
     mutable ArenaVector<Signature *> constructSignatures_;
     mutable PropertyHolder properties_;
 };
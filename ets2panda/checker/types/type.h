@@ -21,6 +21,8 @@
 #include "checker/types/typeRelation.h"
 #include "checker/types/typeFacts.h"
 
+#include <atomic>
+
 namespace ark::es2panda::varbinder {
 class Variable;
 }  // namespace ark::es2panda::varbinder
@@ -47,7 +49,7 @@ class Type {
 public:
     explicit Type(TypeFlag flag) : typeFlags_(flag)
     {
-        static uint64_t typeId = 0;
+        static std::atomic<uint64_t> typeId = 0;
         id_ = ++typeId;
     }
 
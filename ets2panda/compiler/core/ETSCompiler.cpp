@@ -22,6 +22,9 @@
 #include "compiler/core/switchBuilder.h"
 #include "compiler/function/functionBuilder.h"
 #include "checker/types/ets/etsDynamicFunctionType.h"
+#include "ir/expressions/literals/charLiteral.h"
+#include "ir/expressions/literals/numberLiteral.h"
+#include "ir/expressions/literals/stringLiteral.h"
 #include "parser/ETSparser.h"
 #include "programElement.h"
 
@@ -1836,6 +1839,156 @@ void ETSCompiler::Compile([[maybe_unused]] const ir::SwitchCaseStatement *st) co
     UNREACHABLE();
 }
 
+// Switches with fewer keyed cases than this are dispatched by testing the cases one by one
+constexpr size_t SWITCH_TREE_MIN_KEYS = 4U;
+// A subtree with at most this many keys is resolved by testing the keys one by one
+constexpr size_t SWITCH_TREE_LEAF_KEYS = 3U;
+
+// Compile-time dispatch key of a switch: the case value for integer switches, the length for string switches
+struct SwitchDispatchKey {
+    int32_t value;
+    std::vector<uint32_t> cases;
+};
+
+static std::optional<int32_t> IntegerCaseValue(const ir::Expression *test)
+{
+    if (test->IsCharLiteral()) {
+        return static_cast<int32_t>(test->AsCharLiteral()->Char());
+    }
+
+    if (test->IsNumberLiteral() && test->AsNumberLiteral()->Number().IsInt()) {
+        return test->AsNumberLiteral()->Number().GetInt();
+    }
+
+    return std::nullopt;
+}
+
+static std::optional<int32_t> StringCaseLength(const ir::Expression *test)
+{
+    if (!test->IsStringLiteral()) {
+        return std::nullopt;
+    }
+
+    // Runtime strings are measured in UTF-16 code units
+    constexpr char32_t MAX_BMP_CODE_POINT = 0xFFFF;
+    int32_t length = 0;
+    util::StringView::Iterator iter(test->AsStringLiteral()->Str());
+    while (iter.HasNext()) {
+        length += iter.Next() > MAX_BMP_CODE_POINT ? 2 : 1;
+    }
+    return length;
+}
+
+static bool IsIntegerSwitchTag(const checker::Type *type)
+{
+    switch (checker::ETSChecker::TypeKind(type)) {
+        case checker::TypeFlag::BYTE:
+        case checker::TypeFlag::CHAR:
+        case checker::TypeFlag::SHORT:
+        case checker::TypeFlag::INT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+template <typename KeyOf>
+static bool CollectSwitchDispatchKeys(const ir::SwitchStatement *self, const KeyOf &keyOf,
+                                      std::vector<SwitchDispatchKey> &keys)
+{
+    std::map<int32_t, std::vector<uint32_t>> cases;
+    for (uint32_t i = 0; i < self->Cases().size(); i++) {
+        const auto *test = self->Cases()[i]->Test();
+        if (test == nullptr) {
+            continue;
+        }
+
+        auto key = keyOf(test);
+        if (!key.has_value()) {
+            return false;
+        }
+        cases[*key].push_back(i);
+    }
+
+    for (auto &[value, indices] : cases) {
+        keys.push_back({value, std::move(indices)});
+    }
+    return keys.size() >= SWITCH_TREE_MIN_KEYS;
+}
+
+// Binary search over the sorted keys, every subtree keeps the keys whose value is in its range
+template <typename EmitKey>
+static void CompileSwitchCompareTree(ETSGen *etsg, const ir::SwitchStatement *self, VReg key,
+                                     const std::vector<SwitchDispatchKey> &keys, size_t begin, size_t end,
+                                     Label *defaultLabel, const EmitKey &emitKey)
+{
+    if (end - begin <= SWITCH_TREE_LEAF_KEYS) {
+        for (size_t i = begin; i < end; i++) {
+            emitKey(keys[i]);
+        }
+        etsg->Branch(self, defaultLabel);
+        return;
+    }
+
+    size_t mid = begin + (end - begin) / 2U;
+    Label *upper = etsg->AllocLabel();
+
+    etsg->LoadAccumulatorInt(self, keys[mid - 1U].value);
+    etsg->JumpCompareRegister<compiler::Jlt>(self, key, upper);
+    CompileSwitchCompareTree(etsg, self, key, keys, begin, mid, defaultLabel, emitKey);
+
+    etsg->SetLabel(self, upper);
+    CompileSwitchCompareTree(etsg, self, key, keys, mid, end, defaultLabel, emitKey);
+}
+
+// Integer cases are found with a compare tree instead of a chain of equality tests
+static bool CompileIntegerSwitchDispatch(ETSGen *etsg, const ir::SwitchStatement *self,
+                                         compiler::SwitchBuilder<ETSGen> &builder, VReg tag, Label *defaultLabel)
+{
+    std::vector<SwitchDispatchKey> keys;
+    if (!IsIntegerSwitchTag(etsg->GetVRegType(tag)) || !CollectSwitchDispatchKeys(self, IntegerCaseValue, keys)) {
+        return false;
+    }
+
+    // Equal case values can only match the first of them
+    CompileSwitchCompareTree(etsg, self, tag, keys, 0, keys.size(), defaultLabel,
+                             [etsg, self, tag, &builder](const SwitchDispatchKey &key) {
+                                 etsg->LoadAccumulatorInt(self, key.value);
+                                 etsg->JumpCompareRegister<compiler::Jeq>(self, tag, builder.CaseLabel(key.cases[0]));
+                             });
+    return true;
+}
+
+// String cases are grouped by length, only the cases of the matching length are compared as strings
+static bool CompileStringSwitchDispatch(ETSGen *etsg, const ir::SwitchStatement *self,
+                                        compiler::SwitchBuilder<ETSGen> &builder, VReg tag, Label *defaultLabel)
+{
+    const auto *tagType = etsg->GetVRegType(tag);
+    std::vector<SwitchDispatchKey> keys;
+    if (!tagType->IsETSStringType() || !tagType->DefinitelyNotETSNullish() ||
+        !CollectSwitchDispatchKeys(self, StringCaseLength, keys)) {
+        return false;
+    }
+
+    compiler::VReg length = etsg->AllocReg();
+    etsg->LoadAccumulator(self, tag);
+    etsg->LoadStringLength(self);
+    etsg->StoreAccumulator(self, length);
+
+    CompileSwitchCompareTree(etsg, self, length, keys, 0, keys.size(), defaultLabel,
+                             [etsg, self, tag, length, defaultLabel, &builder](const SwitchDispatchKey &key) {
+                                 Label *next = etsg->AllocLabel();
+                                 etsg->LoadAccumulatorInt(self, key.value);
+                                 etsg->JumpCompareRegister<compiler::Jne>(self, length, next);
+                                 for (auto index : key.cases) {
+                                     builder.JumpIfCase(tag, index);
+                                 }
+                                 etsg->Branch(self, defaultLabel);
+                                 etsg->SetLabel(self, next);
+                             });
+    return true;
+}
+
 static void CompileImpl(const ir::SwitchStatement *self, ETSGen *etsg)
 {
     compiler::LocalRegScope lrs(etsg, self->Scope());
@@ -1843,23 +1996,29 @@ static void CompileImpl(const ir::SwitchStatement *self, ETSGen *etsg)
     compiler::VReg tag = etsg->AllocReg();
 
     builder.CompileTagOfSwitch(tag);
-    uint32_t defaultIndex = 0;
-
-    for (size_t i = 0; i < self->Cases().size(); i++) {
-        const auto *clause = self->Cases()[i];
+    std::optional<uint32_t> defaultIndex;
 
-        if (clause->Test() == nullptr) {
+    for (uint32_t i = 0; i < self->Cases().size(); i++) {
+        if (self->Cases()[i]->Test() == nullptr) {
             defaultIndex = i;
-            continue;
         }
-
-        builder.JumpIfCase(tag, i);
     }
 
-    if (defaultIndex > 0) {
-        builder.JumpToDefault(defaultIndex);
-    } else {
-        builder.Break();
+    Label *defaultLabel = defaultIndex.has_value() ? builder.CaseLabel(*defaultIndex) : builder.EndLabel();
+
+    if (!CompileIntegerSwitchDispatch(etsg, self, builder, tag, defaultLabel) &&
+        !CompileStringSwitchDispatch(etsg, self, builder, tag, defaultLabel)) {
+        for (uint32_t i = 0; i < self->Cases().size(); i++) {
+            if (self->Cases()[i]->Test() != nullptr) {
+                builder.JumpIfCase(tag, i);
+            }
+        }
+
+        if (defaultIndex.has_value()) {
+            builder.JumpToDefault(*defaultIndex);
+        } else {
+            builder.Break();
+        }
     }
 
     for (size_t i = 0; i < self->Cases().size(); i++) {
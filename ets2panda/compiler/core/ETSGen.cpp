@@ -24,6 +24,8 @@
 #include "ir/expressions/callExpression.h"
 #include "ir/expressions/memberExpression.h"
 #include "ir/expressions/templateLiteral.h"
+#include "ir/expressions/literals/stringLiteral.h"
+#include "ir/base/templateElement.h"
 #include "ir/statements/breakStatement.h"
 #include "ir/statements/continueStatement.h"
 #include "ir/statements/tryStatement.h"
@@ -2530,30 +2532,35 @@ void ETSGen::UpdateBigInt(const ir::Expression *node, VReg arg, lexer::TokenType
     }
 }
 
+static std::string_view StringBuilderAppendSignature(checker::TypeFlag typeFlag)
+{
+    switch (typeFlag) {
+        case checker::TypeFlag::ETS_BOOLEAN:
+            return Signatures::BUILTIN_STRING_BUILDER_APPEND_BOOLEAN;
+        case checker::TypeFlag::CHAR:
+            return Signatures::BUILTIN_STRING_BUILDER_APPEND_CHAR;
+        case checker::TypeFlag::SHORT:
+        case checker::TypeFlag::BYTE:
+        case checker::TypeFlag::INT:
+            return Signatures::BUILTIN_STRING_BUILDER_APPEND_INT;
+        case checker::TypeFlag::LONG:
+            return Signatures::BUILTIN_STRING_BUILDER_APPEND_LONG;
+        case checker::TypeFlag::FLOAT:
+            return Signatures::BUILTIN_STRING_BUILDER_APPEND_FLOAT;
+        case checker::TypeFlag::DOUBLE:
+            return Signatures::BUILTIN_STRING_BUILDER_APPEND_DOUBLE;
+        default:
+            return Signatures::BUILTIN_STRING_BUILDER_APPEND_BUILTIN_STRING;
+    }
+}
+
 void ETSGen::StringBuilderAppend(const ir::AstNode *node, VReg builder)
 {
     RegScope rs(this);
-    util::StringView signature {};
 
     node->Compile(this);
 
-    std::unordered_map<checker::TypeFlag, std::string_view> typeFlagToSignaturesMap {
-        {checker::TypeFlag::ETS_BOOLEAN, Signatures::BUILTIN_STRING_BUILDER_APPEND_BOOLEAN},
-        {checker::TypeFlag::CHAR, Signatures::BUILTIN_STRING_BUILDER_APPEND_CHAR},
-        {checker::TypeFlag::SHORT, Signatures::BUILTIN_STRING_BUILDER_APPEND_INT},
-        {checker::TypeFlag::BYTE, Signatures::BUILTIN_STRING_BUILDER_APPEND_INT},
-        {checker::TypeFlag::INT, Signatures::BUILTIN_STRING_BUILDER_APPEND_INT},
-        {checker::TypeFlag::LONG, Signatures::BUILTIN_STRING_BUILDER_APPEND_LONG},
-        {checker::TypeFlag::FLOAT, Signatures::BUILTIN_STRING_BUILDER_APPEND_FLOAT},
-        {checker::TypeFlag::DOUBLE, Signatures::BUILTIN_STRING_BUILDER_APPEND_DOUBLE},
-    };
-
-    auto search = typeFlagToSignaturesMap.find(checker::ETSChecker::ETSType(GetAccumulatorType()));
-    if (search != typeFlagToSignaturesMap.end()) {
-        signature = search->second;
-    } else {
-        signature = Signatures::BUILTIN_STRING_BUILDER_APPEND_BUILTIN_STRING;
-    }
+    util::StringView signature = StringBuilderAppendSignature(checker::ETSChecker::ETSType(GetAccumulatorType()));
 
     if (GetAccumulatorType()->IsETSReferenceType() && !GetAccumulatorType()->IsETSStringType()) {
         if (GetAccumulatorType()->PossiblyETSNull()) {
@@ -2579,33 +2586,93 @@ void ETSGen::StringBuilderAppend(const ir::AstNode *node, VReg builder)
     SetAccumulatorType(Checker()->GetGlobalTypesHolder()->GlobalStringBuilderBuiltinType());
 }
 
-void ETSGen::AppendString(const ir::Expression *const expr, const VReg builder)
+void ETSGen::StringBuilderAppendConstant(const ir::AstNode *node, util::StringView str, VReg builder)
+{
+    RegScope rs(this);
+
+    LoadAccumulatorString(node, str);
+    VReg arg0 = AllocReg();
+    StoreAccumulator(node, arg0);
+
+    CallThisStatic1(node, builder, Signatures::BUILTIN_STRING_BUILDER_APPEND_BUILTIN_STRING, arg0);
+    SetAccumulatorType(Checker()->GetGlobalTypesHolder()->GlobalStringBuilderBuiltinType());
+}
+
+// Operand of a string concatenation, a run of adjacent string constants is merged into a single part
+struct ETSGen::StringPart {
+    const ir::AstNode *node;
+    bool isConstant;
+    util::UString constant;
+};
+
+static bool IsStringConcatenation(const ir::Expression *expr)
+{
+    if (!expr->IsBinaryExpression()) {
+        return false;
+    }
+
+    const auto *binExpr = expr->AsBinaryExpression();
+    return binExpr->OperatorType() == lexer::TokenType::PUNCTUATOR_PLUS &&
+           (binExpr->Left()->TsType()->IsETSStringType() || binExpr->Right()->TsType()->IsETSStringType());
+}
+
+void ETSGen::AddStringPart(const ir::AstNode *node, ArenaVector<StringPart> &parts)
+{
+    if (!node->IsStringLiteral() && !node->IsTemplateElement()) {
+        parts.push_back({node, false, util::UString()});
+        return;
+    }
+
+    util::StringView str =
+        node->IsStringLiteral() ? node->AsStringLiteral()->Str() : node->AsTemplateElement()->Cooked();
+    if (str.Empty()) {
+        return;
+    }
+
+    if (!parts.empty() && parts.back().isConstant) {
+        parts.back().constant.Append(str);
+        return;
+    }
+
+    parts.push_back({node, true, util::UString(str, Allocator())});
+}
+
+void ETSGen::CollectStringParts(const ir::Expression *expr, ArenaVector<StringPart> &parts)
 {
     ASSERT((expr->IsBinaryExpression() &&
             expr->AsBinaryExpression()->OperatorType() == lexer::TokenType::PUNCTUATOR_PLUS) ||
            (expr->IsAssignmentExpression() &&
             expr->AsAssignmentExpression()->OperatorType() == lexer::TokenType::PUNCTUATOR_PLUS_EQUAL));
 
+    const ir::Expression *left = nullptr;
+    const ir::Expression *right = nullptr;
     if (expr->IsBinaryExpression()) {
-        StringBuilder(expr->AsBinaryExpression()->Left(), expr->AsBinaryExpression()->Right(), builder);
+        left = expr->AsBinaryExpression()->Left();
+        right = expr->AsBinaryExpression()->Right();
     } else {
-        StringBuilder(expr->AsAssignmentExpression()->Left(), expr->AsAssignmentExpression()->Right(), builder);
+        left = expr->AsAssignmentExpression()->Left();
+        right = expr->AsAssignmentExpression()->Right();
     }
-}
 
-void ETSGen::StringBuilder(const ir::Expression *const left, const ir::Expression *const right, const VReg builder)
-{
-    if (left->IsBinaryExpression()) {
-        AppendString(left->AsBinaryExpression(), builder);
+    // Only nested concatenations are flattened, other binary operands keep their own arithmetic
+    if (IsStringConcatenation(left)) {
+        CollectStringParts(left, parts);
     } else {
-        StringBuilderAppend(left, builder);
+        AddStringPart(left, parts);
     }
 
-    StringBuilderAppend(right, builder);
+    AddStringPart(right, parts);
 }
 
-void ETSGen::BuildString(const ir::Expression *node)
+void ETSGen::BuildStringFromParts(const ir::Expression *node, const ArenaVector<StringPart> &parts)
 {
+    // A chain made of constants only is folded, no builder is needed at runtime
+    if (parts.empty() || (parts.size() == 1 && parts.front().isConstant)) {
+        LoadAccumulatorString(node, parts.empty() ? util::StringView("") : parts.front().constant.View());
+        SetAccumulatorType(Checker()->GlobalBuiltinETSStringType());
+        return;
+    }
+
     RegScope rs(this);
 
     Ra().Emit<InitobjShort, 0>(node, Signatures::BUILTIN_STRING_BUILDER_CTOR, dummyReg_, dummyReg_);
@@ -2614,9 +2681,24 @@ void ETSGen::BuildString(const ir::Expression *node)
     auto builder = AllocReg();
     StoreAccumulator(node, builder);
 
-    AppendString(node, builder);
+    for (const auto &part : parts) {
+        if (part.isConstant) {
+            StringBuilderAppendConstant(part.node, part.constant.View(), builder);
+        } else {
+            StringBuilderAppend(part.node, builder);
+        }
+    }
+
     CallThisStatic0(node, builder, Signatures::BUILTIN_STRING_BUILDER_TO_STRING);
+    SetAccumulatorType(Checker()->GlobalBuiltinETSStringType());
+}
 
+void ETSGen::BuildString(const ir::Expression *node)
+{
+    ArenaVector<StringPart> parts(Allocator()->Adapter());
+    CollectStringParts(node, parts);
+
+    BuildStringFromParts(node, parts);
     SetAccumulatorType(node->TsType());
 }
 
@@ -2644,41 +2726,19 @@ void ETSGen::CallBigIntBinaryComparison(const ir::Expression *node, VReg lhs, VR
 
 void ETSGen::BuildTemplateString(const ir::TemplateLiteral *node)
 {
-    RegScope rs(this);
-
-    Ra().Emit<InitobjShort, 0>(node, Signatures::BUILTIN_STRING_BUILDER_CTOR, dummyReg_, dummyReg_);
-    SetAccumulatorType(Checker()->GlobalStringBuilderBuiltinType());
-
-    auto builder = AllocReg();
-    StoreAccumulator(node, builder);
-
-    // Just to reduce extra nested level(s):
-    auto const appendExpressions = [this, &builder](ArenaVector<ir::Expression *> const &expressions,
-                                                    ArenaVector<ir::TemplateElement *> const &quasis) -> void {
-        auto const num = expressions.size();
-        std::size_t i = 0U;
-
-        while (i < num) {
-            StringBuilderAppend(expressions[i], builder);
-            if (!quasis[++i]->Raw().Empty()) {
-                StringBuilderAppend(quasis[i], builder);
-            }
-        }
-    };
+    ArenaVector<StringPart> parts(Allocator()->Adapter());
 
     if (auto const &quasis = node->Quasis(); !quasis.empty()) {
-        if (!quasis[0]->Raw().Empty()) {
-            StringBuilderAppend(quasis[0], builder);
-        }
+        auto const &expressions = node->Expressions();
+        AddStringPart(quasis[0], parts);
 
-        if (auto const &expressions = node->Expressions(); !expressions.empty()) {
-            appendExpressions(expressions, quasis);
+        for (std::size_t i = 0U; i < expressions.size(); ++i) {
+            AddStringPart(expressions[i], parts);
+            AddStringPart(quasis[i + 1U], parts);
         }
     }
 
-    CallThisStatic0(node, builder, Signatures::BUILTIN_STRING_BUILDER_TO_STRING);
-
-    SetAccumulatorType(Checker()->GlobalBuiltinETSStringType());
+    BuildStringFromParts(node, parts);
 }
 
 void ETSGen::NewObject(const ir::AstNode *const node, const VReg ctor, const util::StringView name)
@@ -642,9 +642,12 @@ private:
                          const checker::Type *boxedType);
 
     void LoadConstantObject(const ir::Expression *node, const checker::Type *type);
+    struct StringPart;
+    void AddStringPart(const ir::AstNode *node, ArenaVector<StringPart> &parts);
+    void CollectStringParts(const ir::Expression *expr, ArenaVector<StringPart> &parts);
+    void BuildStringFromParts(const ir::Expression *node, const ArenaVector<StringPart> &parts);
     void StringBuilderAppend(const ir::AstNode *node, VReg builder);
-    void AppendString(const ir::Expression *binExpr, VReg builder);
-    void StringBuilder(const ir::Expression *left, const ir::Expression *right, VReg builder);
+    void StringBuilderAppendConstant(const ir::AstNode *node, util::StringView str, VReg builder);
     util::StringView FormClassPropReference(varbinder::Variable const *var);
     void UnaryMinus(const ir::AstNode *node);
     void UnaryTilde(const ir::AstNode *node);
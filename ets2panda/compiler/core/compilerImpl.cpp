@@ -204,14 +204,14 @@ static void SetupPublicContext(public_lib::Context *context, const SourceFile *s
 #ifndef NDEBUG
 
 static bool RunVerifierAndPhases(ArenaAllocator &allocator, const CompilerContext &context,
-                                 public_lib::Context &publicContext, const std::vector<Phase *> &phases,
+                                 public_lib::Context &publicContext, const PhaseList &phases,
                                  parser::Program &program)
 {
     auto runner = ASTVerificationRunner(allocator, context);
     auto verificationCtx = ast_verifier::VerificationContext {};
     const auto runAllChecks = context.Options()->verifierAllChecks;
 
-    for (auto *phase : phases) {
+    for (const auto &phase : phases) {
         if (!phase->Apply(&publicContext, &program)) {
             return false;
         }
@@ -242,7 +242,7 @@ static bool RunVerifierAndPhases(ArenaAllocator &allocator, const CompilerContex
 #endif
 
 using EmitCb = std::function<pandasm::Program *(compiler::CompilerContext *)>;
-using PhaseListGetter = std::function<std::vector<compiler::Phase *>(ScriptExtension)>;
+using PhaseListGetter = std::function<compiler::PhaseList(ScriptExtension)>;
 
 template <typename Parser, typename VarBinder, typename Checker, typename Analyzer, typename AstCompiler,
           typename CodeGen, typename RegSpiller, typename FunctionEmitter, typename Emitter>
@@ -280,14 +280,14 @@ static pandasm::Program *CreateCompiler(const CompilationUnit &unit, const Phase
             return nullptr;
         }
     } else {
-        for (auto *phase : phases) {
+        for (const auto &phase : phases) {
             if (!phase->Apply(&publicContext, &program)) {
                 return nullptr;
             }
         }
     }
 #else
-    for (auto *phase : phases) {
+    for (const auto &phase : phases) {
         if (!phase->Apply(&publicContext, &program)) {
             return nullptr;
         }
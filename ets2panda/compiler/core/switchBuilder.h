@@ -94,6 +94,16 @@ public:
         cg_->Branch(stmt_, end_);
     }
 
+    Label *CaseLabel(uint32_t index) const
+    {
+        return caseLabels_[index];
+    }
+
+    Label *EndLabel() const
+    {
+        return end_;
+    }
+
 private:
     CodeGen *cg_;
     Label *end_;
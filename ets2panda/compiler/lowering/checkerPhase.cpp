@@ -23,8 +23,12 @@
 namespace ark::es2panda::compiler {
 bool CheckerPhase::Perform(public_lib::Context *ctx, [[maybe_unused]] parser::Program *program)
 {
-    auto checkerResult =
-        ctx->checker->StartChecker(ctx->compilerContext->VarBinder(), *ctx->compilerContext->Options());
+    const auto *options = ctx->compilerContext->Options();
+    auto checkerResult = ctx->checker->StartChecker(ctx->compilerContext->VarBinder(), *options);
+    // Skipped bodies stay unchecked, such a program can be inspected but not lowered or compiled
+    if (options->checkSignaturesOnly) {
+        return false;
+    }
     auto typeCheckerResult = checker::RunTypeChecker(ctx->checker, program->Extension(), program->Ast());
     return checkerResult && typeCheckerResult;
 }
@@ -38,105 +38,79 @@
 #include "compiler/lowering/scopesInit/scopesInitPhase.h"
 #include "ets/defaultParameterLowering.h"
 #include "lexer/token/sourceLocation.h"
+#include "mem/mem_config.h"
 #include "public/es2panda_lib.h"
 
-namespace ark::es2panda::compiler {
+#include <algorithm>
+#include <sstream>
 
-static CheckerPhase g_checkerPhase;
+namespace ark::es2panda::compiler {
 
-std::vector<Phase *> GetTrivialPhaseList()
+// Phases keep per-program state between their calls, so every compilation gets its own instances
+template <typename... Phases>
+static PhaseList MakePhaseList(std::unique_ptr<Phases>... phases)
 {
-    return std::vector<Phase *> {
-        &g_checkerPhase,
-    };
+    PhaseList list;
+    list.reserve(sizeof...(phases));
+    (list.push_back(std::move(phases)), ...);
+    return list;
 }
 
-static BigIntLowering g_bigintLowering;
-static InterfacePropertyDeclarationsPhase g_interfacePropDeclPhase;
-static LambdaConstructionPhase g_lambdaConstructionPhase;
-static OpAssignmentLowering g_opAssignmentLowering;
-static ObjectIndexLowering g_objectIndexLowering;
-static ObjectIteratorLowering g_objectIteratorLowering;
-static ObjectLiteralLowering g_objectLiteralLowering;
-static TupleLowering g_tupleLowering;  // Can be only applied after checking phase, and OP_ASSIGNMENT_LOWERING phase
-static UnionLowering g_unionLowering;
-static OptionalLowering g_optionalLowering;
-static ExpandBracketsPhase g_expandBracketsPhase;
-static PromiseVoidInferencePhase g_promiseVoidInferencePhase;
-static RecordLowering g_recordLowering;
-static StructLowering g_structLowering;
-static DefaultParameterLowering g_defaultParameterLowering;
-static TopLevelStatements g_topLevelStatements;
-static LocalClassConstructionPhase g_localClassLowering;
-static PluginPhase g_pluginsAfterParse {"plugins-after-parse", ES2PANDA_STATE_PARSED, &util::Plugin::AfterParse};
-static PluginPhase g_pluginsAfterCheck {"plugins-after-check", ES2PANDA_STATE_CHECKED, &util::Plugin::AfterCheck};
-static PluginPhase g_pluginsAfterLowerings {"plugins-after-lowering", ES2PANDA_STATE_LOWERED,
-                                            &util::Plugin::AfterLowerings};
-// NOLINTBEGIN(fuchsia-statically-constructed-objects)
-static InitScopesPhaseETS g_initScopesPhaseEts;
-static InitScopesPhaseAS g_initScopesPhaseAs;
-static InitScopesPhaseTs g_initScopesPhaseTs;
-static InitScopesPhaseJs g_initScopesPhaseJs;
-// NOLINTEND(fuchsia-statically-constructed-objects)
+PhaseList GetTrivialPhaseList()
+{
+    return MakePhaseList(std::make_unique<CheckerPhase>());
+}
 
 static void CheckOptionsBeforePhase(const CompilerOptions *options, const parser::Program *program,
                                     const std::string &name);
 static void CheckOptionsAfterPhase(const CompilerOptions *options, const parser::Program *program,
                                    const std::string &name);
 
-std::vector<Phase *> GetETSPhaseList()
+PhaseList GetETSPhaseList()
 {
-    return {
-        &g_pluginsAfterParse,
-        &g_topLevelStatements,
-        &g_defaultParameterLowering,
-        &g_bigintLowering,
-        &g_initScopesPhaseEts,
-        &g_optionalLowering,
-        &g_promiseVoidInferencePhase,
-        &g_structLowering,
-        &g_lambdaConstructionPhase,
-        &g_interfacePropDeclPhase,
-        &g_checkerPhase,
-        &g_pluginsAfterCheck,
-        &g_opAssignmentLowering,
-        &g_recordLowering,
-        &g_objectIndexLowering,
-        &g_objectIteratorLowering,
-        &g_tupleLowering,
-        &g_unionLowering,
-        &g_expandBracketsPhase,
-        &g_localClassLowering,
-        &g_objectLiteralLowering,
-        &g_pluginsAfterLowerings,
-    };
+    return MakePhaseList(
+        std::make_unique<PluginPhase>("plugins-after-parse", ES2PANDA_STATE_PARSED, &util::Plugin::AfterParse),
+        std::make_unique<TopLevelStatements>(),
+        std::make_unique<DefaultParameterLowering>(),
+        std::make_unique<BigIntLowering>(),
+        std::make_unique<InitScopesPhaseETS>(),
+        std::make_unique<OptionalLowering>(),
+        std::make_unique<PromiseVoidInferencePhase>(),
+        std::make_unique<StructLowering>(),
+        std::make_unique<LambdaConstructionPhase>(),
+        std::make_unique<InterfacePropertyDeclarationsPhase>(),
+        std::make_unique<CheckerPhase>(),
+        std::make_unique<PluginPhase>("plugins-after-check", ES2PANDA_STATE_CHECKED, &util::Plugin::AfterCheck),
+        std::make_unique<OpAssignmentLowering>(),
+        std::make_unique<RecordLowering>(),
+        std::make_unique<ObjectIndexLowering>(),
+        std::make_unique<ObjectIteratorLowering>(),
+        // Can be only applied after checking phase, and OP_ASSIGNMENT_LOWERING phase
+        std::make_unique<TupleLowering>(),
+        std::make_unique<UnionLowering>(),
+        std::make_unique<ExpandBracketsPhase>(),
+        std::make_unique<LocalClassConstructionPhase>(),
+        std::make_unique<ObjectLiteralLowering>(),
+        std::make_unique<PluginPhase>("plugins-after-lowering", ES2PANDA_STATE_LOWERED,
+                                      &util::Plugin::AfterLowerings));
 }
 
-std::vector<Phase *> GetASPhaseList()
+PhaseList GetASPhaseList()
 {
-    return {
-        &g_initScopesPhaseAs,
-        &g_checkerPhase,
-    };
+    return MakePhaseList(std::make_unique<InitScopesPhaseAS>(), std::make_unique<CheckerPhase>());
 }
 
-std::vector<Phase *> GetTSPhaseList()
+PhaseList GetTSPhaseList()
 {
-    return {
-        &g_initScopesPhaseTs,
-        &g_checkerPhase,
-    };
+    return MakePhaseList(std::make_unique<InitScopesPhaseTs>(), std::make_unique<CheckerPhase>());
 }
 
-std::vector<Phase *> GetJSPhaseList()
+PhaseList GetJSPhaseList()
 {
-    return {
-        &g_initScopesPhaseJs,
-        &g_checkerPhase,
-    };
+    return MakePhaseList(std::make_unique<InitScopesPhaseJs>(), std::make_unique<CheckerPhase>());
 }
 
-std::vector<Phase *> GetPhaseList(ScriptExtension ext)
+PhaseList GetPhaseList(ScriptExtension ext)
 {
     switch (ext) {
         case ScriptExtension::ETS:
@@ -152,6 +126,26 @@ std::vector<Phase *> GetPhaseList(ScriptExtension ext)
     }
 }
 
+// A failed arena allocation ends the compilation deep inside a phase without a message, so a phase leaving less than
+// this part of the compiler memory space free stops it with an explanation instead
+static constexpr size_t MEMORY_LIMIT_HEADROOM_DIVISOR = 8U;
+
+static void CheckMemoryLimit(public_lib::Context *ctx, const std::string &name)
+{
+    size_t used = ctx->allocator->GetAllocatedSize();
+    ctx->memoryPeak = std::max(ctx->memoryPeak, used);
+
+    size_t limit = mem::MemConfig::GetCompilerMemorySizeLimit();
+    if (used <= limit - limit / MEMORY_LIMIT_HEADROOM_DIVISOR) {
+        return;
+    }
+
+    std::stringstream ss;
+    ss << "The compiler memory limit of " << limit / 1_MB << " MB is almost exhausted after phase '" << name << "', "
+       << used / 1_MB << " MB are in use. Raise the limit with --compiler-memory-limit.";
+    throw Error(ErrorType::GENERIC, "", ss.str());
+}
+
 bool Phase::Apply(public_lib::Context *ctx, parser::Program *program)
 {
     const auto *options = ctx->compilerContext->Options();
@@ -174,6 +168,7 @@ bool Phase::Apply(public_lib::Context *ctx, parser::Program *program)
     }
 
     CheckOptionsAfterPhase(options, program, name);
+    CheckMemoryLimit(ctx, name);
 
 #ifndef NDEBUG
     if (!Postcondition(ctx, program)) {
@@ -19,10 +19,17 @@
 #include "parser/program/program.h"
 #include "public/public.h"
 
+#include <memory>
+
 namespace ark::es2panda::compiler {
 
 class Phase {
 public:
+    Phase() = default;
+    NO_COPY_SEMANTIC(Phase);
+    NO_MOVE_SEMANTIC(Phase);
+    virtual ~Phase() = default;
+
     /* If Apply returns false, processing is stopped. */
     bool Apply(public_lib::Context *ctx, parser::Program *program);
 
@@ -41,7 +48,9 @@ public:
     }
 };
 
-std::vector<Phase *> GetPhaseList(ScriptExtension ext);
+using PhaseList = std::vector<std::unique_ptr<Phase>>;
+
+PhaseList GetPhaseList(ScriptExtension ext);
 
 }  // namespace ark::es2panda::compiler
 
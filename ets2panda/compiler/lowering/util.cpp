@@ -17,6 +17,8 @@
 
 #include "ir/expressions/identifier.h"
 
+#include <atomic>
+
 namespace ark::es2panda::compiler {
 
 varbinder::Scope *NearestScope(const ir::AstNode *ast)
@@ -37,7 +39,7 @@ ir::Identifier *Gensym(ArenaAllocator *const allocator)
 util::UString GenName(ArenaAllocator *const allocator)
 {
     static std::string const GENSYM_CORE = "gensym$_";
-    static std::size_t gensymCounter = 0U;
+    static std::atomic<std::size_t> gensymCounter = 0U;
 
     return util::UString {GENSYM_CORE + std::to_string(++gensymCounter), allocator};
 }
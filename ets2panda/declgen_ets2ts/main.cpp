@@ -16,16 +16,31 @@
 #include "public/es2panda_lib.h"
 #include "public/public.h"
 #include "declgenEts2Ts.h"
+#include "util/arktsconfig.h"
+
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#ifdef ARKTSCONFIG_USE_FILESYSTEM
+#include <filesystem>
+namespace fs = std::filesystem;
+#endif
 
 namespace ark::es2panda::declgen_ets2ts {
 
-static int Run(int argc, const char **argv)
+static bool CheckContext(const es2panda_Impl *impl, es2panda_Context *ctx)
 {
-    const auto *impl = es2panda_GetImpl(ES2PANDA_LIB_VERSION);
-    auto *cfg = impl->CreateConfig(argc, argv);
-    if (cfg == nullptr) {
-        return 1;
+    if (impl->ContextState(ctx) == ES2PANDA_STATE_ERROR) {
+        std::cerr << impl->ContextErrorMessage(ctx) << std::endl;
+        return false;
     }
+    return true;
+}
+
+static int GenerateForFile(const es2panda_Impl *impl, es2panda_Config *cfg)
+{
     auto *cfgImpl = reinterpret_cast<ark::es2panda::public_lib::ConfigImpl *>(cfg);
 
     es2panda_Context *ctx = impl->CreateContextFromString(cfg, cfgImpl->options->ParserInput().c_str(),
@@ -34,16 +49,115 @@ static int Run(int argc, const char **argv)
     auto *ctxImpl = reinterpret_cast<ark::es2panda::public_lib::Context *>(ctx);
     auto *checker = reinterpret_cast<checker::ETSChecker *>(ctxImpl->checker);
 
-    impl->ProceedToState(ctx, ES2PANDA_STATE_CHECKED);
+    ctx = impl->ProceedToState(ctx, ES2PANDA_STATE_CHECKED);
 
     int res = 0;
-    if (!GenerateTsDeclarations(checker, ctxImpl->parserProgram, cfgImpl->options->CompilerOutput())) {
+    if (!CheckContext(impl, ctx) ||
+        !GenerateTsDeclarations(checker, ctxImpl->parserProgram, cfgImpl->options->CompilerOutput())) {
         res = 1;
     }
 
     impl->DestroyContext(ctx);
-    impl->DestroyConfig(cfg);
+    return res;
+}
+
+#ifdef ARKTSCONFIG_USE_FILESYSTEM
+// All sources of the project are imported by one synthetic entry file, so the stdlib and the shared imports
+// are parsed and checked once for the whole project
+static int GenerateForProject(const es2panda_Impl *impl, es2panda_Config *cfg)
+{
+    auto *cfgImpl = reinterpret_cast<ark::es2panda::public_lib::ConfigImpl *>(cfg);
+    const auto &arktsConfig = cfgImpl->options->CompilerOptions().arktsConfig;
+    auto compilationList = FindProjectSources(arktsConfig);
+    if (compilationList.empty()) {
+        std::cerr << "Error: No files to generate declarations for" << std::endl;
+        return 1;
+    }
+
+    auto entry = fs::path(arktsConfig->RootDir()) / "__declgen_batch_entry__.ets";
+    std::stringstream entrySource;
+    std::unordered_map<std::string, std::string> outputs;
+    for (size_t i = 0; i < compilationList.size(); i++) {
+        const auto &[src, dst] = compilationList[i];
+        auto importPath = fs::relative(src, entry.parent_path()).replace_extension("");
+        entrySource << "import * as __declgen_" << i << " from \"./" << importPath.generic_string() << "\";\n";
+        outputs.emplace(fs::weakly_canonical(src).string(), fs::path(dst).replace_extension("d.ts").string());
+    }
+
+    auto source = entrySource.str();
+    es2panda_Context *ctx = impl->CreateContextFromString(cfg, source.c_str(), entry.string().c_str());
+    ctx = impl->ProceedToState(ctx, ES2PANDA_STATE_PARSED);
+    if (!CheckContext(impl, ctx)) {
+        impl->DestroyContext(ctx);
+        return 1;
+    }
+
+    auto *ctxImpl = reinterpret_cast<ark::es2panda::public_lib::Context *>(ctx);
+    auto *checker = reinterpret_cast<checker::ETSChecker *>(ctxImpl->checker);
+
+    // The project sources are external to the entry file, their bodies are checked when return types are inferred
+    // from them, as it is done for the input file in the single file mode
+    std::vector<std::pair<const parser::Program *, const std::string *>> projectPrograms;
+    for (const auto &[_, programs] : ctxImpl->parserProgram->ExternalSources()) {
+        (void)_;
+        for (const auto *program : programs) {
+            auto output = outputs.find(fs::weakly_canonical(program->SourceFilePath().Mutf8()).string());
+            if (output != outputs.end()) {
+                checker->AddInferredReturnProgram(program);
+                projectPrograms.emplace_back(program, &output->second);
+            }
+        }
+    }
 
+    ctx = impl->ProceedToState(ctx, ES2PANDA_STATE_CHECKED);
+    if (!CheckContext(impl, ctx)) {
+        impl->DestroyContext(ctx);
+        return 1;
+    }
+
+    int res = 0;
+    for (const auto &[program, output] : projectPrograms) {
+        cfgImpl->options->ListFiles() && std::cout << "> declgen: generating '" << *output << "'" << std::endl;
+        if (!GenerateTsDeclarations(checker, program, *output)) {
+            res = 1;
+        }
+    }
+
+    if (projectPrograms.size() != outputs.size()) {
+        std::cerr << "Error: Declarations were generated for " << projectPrograms.size() << " of " << outputs.size()
+                  << " files" << std::endl;
+        res = 1;
+    }
+
+    impl->DestroyContext(ctx);
+    return res;
+}
+#else
+static int GenerateForProject([[maybe_unused]] const es2panda_Impl *impl, [[maybe_unused]] es2panda_Config *cfg)
+{
+    std::cerr << "Error: Project mode is not supported on this platform" << std::endl;
+    return 1;
+}
+#endif
+
+static int Run(int argc, const char **argv)
+{
+    // Declarations only need signatures, bodies of functions with an explicit return type are not checked
+    std::vector<const char *> args(argv, argv + argc);
+    args.insert(args.begin() + 1, "--check-signatures-only");
+
+    const auto *impl = es2panda_GetImpl(ES2PANDA_LIB_VERSION);
+    auto *cfg = impl->CreateConfig(static_cast<int>(args.size()), args.data());
+    if (cfg == nullptr) {
+        return 1;
+    }
+    auto *cfgImpl = reinterpret_cast<ark::es2panda::public_lib::ConfigImpl *>(cfg);
+
+    int res = cfgImpl->options->CompilerOptions().compilationMode == CompilationMode::PROJECT
+                  ? GenerateForProject(impl, cfg)
+                  : GenerateForFile(impl, cfg);
+
+    impl->DestroyConfig(cfg);
     return res;
 }
 }  // namespace ark::es2panda::declgen_ets2ts
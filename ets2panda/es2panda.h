@@ -102,6 +102,7 @@ struct CompilerOptions {
     bool dumpAsm {};
     bool dumpDebugInfo {};
     bool parseOnly {};
+    bool checkSignaturesOnly {};
     bool verifierAllChecks {};
     bool verifierFullProgram {};
     std::string stdLib {};
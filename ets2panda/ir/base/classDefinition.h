@@ -23,6 +23,8 @@
 #include "util/bitset.h"
 #include "util/language.h"
 
+#include <atomic>
+
 namespace ark::es2panda::ir {
 class ClassElement;
 class Identifier;
@@ -374,7 +376,8 @@ private:
     es2panda::Language lang_;
     ArenaSet<varbinder::Variable *> capturedVars_;
     ArenaSet<varbinder::Variable *> localVariableIsNeeded_;
-    static int classCounter_;
+    // Classes of contexts compiled on different threads are counted together
+    static std::atomic<int> classCounter_;
     const int localIndex_ {};
     const std::string localPrefix_ {};
 };
@@ -216,7 +216,6 @@ std::vector<Program *> ETSParser::ParseSources()
         if (parseList[idx].isParsed) {
             continue;
         }
-        std::ifstream inputStream(parseList[idx].sourcePath.Mutf8());
         const auto data = importPathManager_->GetImportData(parseList[idx].sourcePath, Extension());
         if (!data.hasDecl) {
             continue;
@@ -226,16 +225,13 @@ std::vector<Program *> ETSParser::ParseSources()
             break;
         }
 
-        if (inputStream.fail()) {
+        auto externalSource = ReadExternalSource(parseList[idx].sourcePath.Mutf8());
+        if (externalSource == nullptr) {
             ThrowSyntaxError({"Failed to open file: ", parseList[idx].sourcePath.Mutf8()});
         }
 
-        std::stringstream ss;
-        ss << inputStream.rdbuf();
-        auto externalSource = ss.str();
-
         auto currentLang = GetContext().SetLanguage(data.lang);
-        auto extSrc = Allocator()->New<util::UString>(externalSource, Allocator());
+        auto extSrc = Allocator()->New<util::UString>(*externalSource, Allocator());
         auto newProg = ParseSource(
             {parseList[idx].sourcePath.Utf8(), extSrc->View().Utf8(), parseList[idx].sourcePath.Utf8(), false});
 
@@ -246,6 +242,22 @@ std::vector<Program *> ETSParser::ParseSources()
     return programs;
 }
 
+std::shared_ptr<const std::string> ETSParser::ReadExternalSource(const std::string &path) const
+{
+    if (sourceCache_ != nullptr) {
+        return sourceCache_->Read(path);
+    }
+
+    std::ifstream inputStream(path);
+    if (inputStream.fail()) {
+        return nullptr;
+    }
+
+    std::stringstream ss;
+    ss << inputStream.rdbuf();
+    return std::make_shared<const std::string>(ss.str());
+}
+
 parser::Program *ETSParser::ParseSource(const SourceFile &sourceFile)
 {
     importPathManager_->MarkAsParsed(sourceFile.filePath);
@@ -18,6 +18,7 @@
 
 #include "util/arktsconfig.h"
 #include "util/importPathManager.h"
+#include "util/sourceCache.h"
 #include "TypedParser.h"
 
 namespace ark::es2panda::ir {
@@ -61,6 +62,11 @@ public:
         return importPathManager_->ModuleList();
     }
 
+    void SetSourceCache(util::SourceCache *sourceCache)
+    {
+        sourceCache_ = sourceCache;
+    }
+
     //  Methods to create AST node(s) from the specified string (part of valid ETS-code!)
     ir::Expression *CreateExpression(std::string_view sourceCode,
                                      ExpressionParseFlags flags = ExpressionParseFlags::NO_OPTS,
@@ -121,6 +127,7 @@ private:
     void ParseUserSources(std::vector<std::string> userParths);
     ArenaVector<ir::Statement *> ParseTopLevelDeclaration();
     std::vector<Program *> ParseSources();
+    std::shared_ptr<const std::string> ReadExternalSource(const std::string &path) const;
     std::tuple<ir::ImportSource *, std::vector<std::string>> ParseFromClause(bool requireFrom);
     ArenaVector<ir::ImportSpecifier *> ParseNamedSpecifiers();
     ArenaVector<ir::ETSImportDeclaration *> ParseImportDeclarations();
@@ -352,6 +359,7 @@ private:
     parser::Program *globalProgram_;
     std::vector<ir::AstNode *> insertingNodes_ {};
     std::unique_ptr<util::ImportPathManager> importPathManager_ {nullptr};
+    util::SourceCache *sourceCache_ {nullptr};
 };
 
 class ExternalSourceParser {
@@ -14,7 +14,12 @@
  */
 
 #include "es2panda_lib.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include "compiler/lowering/scopesInit/scopesInitPhase.h"
 
 #include "varbinder/varbinder.h"
@@ -81,27 +86,95 @@ struct TokenTypeToStr {
     char const *str;
 };
 
-static lexer::TokenType StrToToken(TokenTypeToStr const *table, char const *str)
-{
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    for (auto *tp = table; tp->str != nullptr; tp++) {
-        if (strcmp(str, tp->str) == 0) {
-            return tp->token;
+// Operator tables are consulted on every Create*Expression and operator accessor call, so both directions are
+// resolved through perfect hash tables whose seeds are searched for at compile time
+template <size_t N>
+class TokenTable {
+public:
+    constexpr explicit TokenTable(std::array<TokenTypeToStr, N> const &entries) : entries_(entries)
+    {
+        while (!FillSlots(strSlots_, strSeed_, true)) {
+            strSeed_++;
+        }
+        while (!FillSlots(tokenSlots_, tokenSeed_, false)) {
+            tokenSeed_++;
         }
     }
-    UNREACHABLE();
-}
 
-static char const *TokenToStr(TokenTypeToStr const *table, lexer::TokenType token)
-{
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    for (auto *tp = table; tp->str != nullptr; tp++) {
-        if (tp->token == token) {
-            return tp->str;
+    lexer::TokenType Token(char const *str) const
+    {
+        auto index = strSlots_[StrSlot(str, strSeed_)];
+        if (index == EMPTY_SLOT || std::strcmp(entries_[index].str, str) != 0) {
+            UNREACHABLE();
         }
+        return entries_[index].token;
     }
-    UNREACHABLE();
-}
+
+    char const *Str(lexer::TokenType token) const
+    {
+        auto index = tokenSlots_[TokenSlot(token, tokenSeed_)];
+        if (index == EMPTY_SLOT || entries_[index].token != token) {
+            UNREACHABLE();
+        }
+        return entries_[index].str;
+    }
+
+private:
+    static constexpr uint32_t FNV_OFFSET_BASIS = 2166136261U;
+    static constexpr uint32_t FNV_PRIME = 16777619U;
+    static constexpr uint32_t GOLDEN_RATIO = 2654435769U;
+    static constexpr uint32_t HASH_BITS = 32U;
+    // At least four slots per entry keep the seed search short
+    static constexpr uint32_t SLOT_BITS = [] {
+        uint32_t bits = 0;
+        while ((size_t {1U} << bits) < 4U * N) {
+            bits++;
+        }
+        return bits;
+    }();
+    static constexpr size_t SLOTS = size_t {1U} << SLOT_BITS;
+    static constexpr uint8_t EMPTY_SLOT = std::numeric_limits<uint8_t>::max();
+    static_assert(N < EMPTY_SLOT);
+
+    using Slots = std::array<uint8_t, SLOTS>;
+
+    static constexpr size_t StrSlot(char const *str, uint32_t seed)
+    {
+        uint32_t hash = FNV_OFFSET_BASIS ^ seed;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for (; *str != '\0'; str++) {
+            hash = (hash ^ static_cast<uint8_t>(*str)) * FNV_PRIME;
+        }
+        return (hash * GOLDEN_RATIO) >> (HASH_BITS - SLOT_BITS);
+    }
+
+    static constexpr size_t TokenSlot(lexer::TokenType token, uint32_t seed)
+    {
+        uint32_t hash = (static_cast<uint32_t>(token) + seed) * GOLDEN_RATIO;
+        return hash >> (HASH_BITS - SLOT_BITS);
+    }
+
+    constexpr bool FillSlots(Slots &slots, uint32_t seed, bool byStr) const
+    {
+        for (auto &slot : slots) {
+            slot = EMPTY_SLOT;
+        }
+        for (size_t i = 0; i < N; i++) {
+            size_t slot = byStr ? StrSlot(entries_[i].str, seed) : TokenSlot(entries_[i].token, seed);
+            if (slots[slot] != EMPTY_SLOT) {
+                return false;
+            }
+            slots[slot] = static_cast<uint8_t>(i);
+        }
+        return true;
+    }
+
+    std::array<TokenTypeToStr, N> entries_;
+    Slots strSlots_ {};
+    Slots tokenSlots_ {};
+    uint32_t strSeed_ {0};
+    uint32_t tokenSeed_ {0};
+};
 
 static char const *StringViewToCString(ArenaAllocator *allocator, util::StringView const sv)
 {
@@ -118,17 +191,32 @@ static char const *StringViewToCString(ArenaAllocator *allocator, util::StringVi
     // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, readability-simplify-subscript-expr)
 }
 
-static char const *ArenaStrdup(ArenaAllocator *allocator, char const *src)
+// Interned copies stay in the context arena, repeated requests for the same text return the same pointer
+static char const *InternCString(Context *ctx, std::string_view str)
 {
-    size_t len = strlen(src);
-    char *res = reinterpret_cast<char *>(allocator->Alloc(len + 1));
-    memmove(res, src, len);
+    auto found = ctx->cStrings.find(str);
+    if (found != ctx->cStrings.end()) {
+        return found->second;
+    }
 
+    char *res = reinterpret_cast<char *>(ctx->allocator->Alloc(str.size() + 1));
+    memmove(res, str.data(), str.size());
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    res[len] = '\0';
+    res[str.size()] = '\0';
+    ctx->cStrings.emplace(std::string_view {res, str.size()}, res);
     return res;
 }
 
+static char const *StringViewToCString(Context *ctx, util::StringView const sv)
+{
+    std::string_view utf8 = sv.Utf8();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic, readability-simplify-subscript-expr)
+    if (utf8.data()[utf8.size()] == '\0') {
+        return utf8.data();
+    }
+    return InternCString(ctx, utf8);
+}
+
 static ir::ModifierFlags E2pToIrAccessFlags(es2panda_ModifierFlags e2pFlags)
 {
     ir::ModifierFlags irFlags {ir::ModifierFlags::NONE};
@@ -366,22 +454,43 @@ static es2panda_ScriptFunctionFlags IrToE2pScriptFunctionFlags(ir::ScriptFunctio
     return e2pFlags;
 }
 
+// Configs can be created and destroyed from several threads, each context only touches its own objects
+static std::mutex g_memSubsystemMutex;
+static size_t g_memSubsystemUsers = 0;
+static uint32_t g_memSubsystemLimit = 0;
+static std::string g_memSubsystemLogLevel;
+
 extern "C" es2panda_Config *CreateConfig(int args, char const **argv)
 {
-    constexpr auto COMPILER_SIZE = 256_MB;
-
-    mem::MemConfig::Initialize(0, 0, COMPILER_SIZE, 0, 0, 0);
-    PoolManager::Initialize(PoolType::MMAP);
-
     auto *options = new util::Options();
     if (!options->Parse(args, argv)) {
         // NOTE: gogabr. report option errors properly.
         std::cerr << options->ErrorMsg() << std::endl;
+        delete options;
         return nullptr;
     }
-    Logger::ComponentMask mask {};
-    mask.set(Logger::Component::ES2PANDA);
-    Logger::InitializeStdLogging(Logger::LevelFromString(options->LogLevel()), mask);
+
+    {
+        // The memory subsystem is process wide, it is set up by the first live config and torn down by the last one
+        std::lock_guard<std::mutex> lock(g_memSubsystemMutex);
+        if (g_memSubsystemUsers == 0) {
+            mem::MemConfig::Initialize(0, 0, options->CompilerMemoryLimit() * 1_MB, 0, 0, 0);
+            PoolManager::Initialize(PoolType::MMAP);
+            Logger::ComponentMask mask {};
+            mask.set(Logger::Component::ES2PANDA);
+            Logger::InitializeStdLogging(Logger::LevelFromString(options->LogLevel()), mask);
+            g_memSubsystemLimit = options->CompilerMemoryLimit();
+            g_memSubsystemLogLevel = options->LogLevel();
+        } else if (options->CompilerMemoryLimit() != g_memSubsystemLimit ||
+                   options->LogLevel() != g_memSubsystemLogLevel) {
+            // Neither setting can be changed while the memory subsystem is in use by other configs
+            std::cerr << "Error: --compiler-memory-limit and --log-level must be the same for all live configs."
+                      << std::endl;
+            delete options;
+            return nullptr;
+        }
+        g_memSubsystemUsers++;
+    }
 
     auto *res = new ConfigImpl;
     res->options = options;
@@ -390,14 +499,20 @@ extern "C" es2panda_Config *CreateConfig(int args, char const **argv)
 
 extern "C" void DestroyConfig(es2panda_Config *config)
 {
-    PoolManager::Finalize();
-    mem::MemConfig::Finalize();
-
     auto *cfg = reinterpret_cast<ConfigImpl *>(config);
     if (cfg == nullptr) {
         return;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(g_memSubsystemMutex);
+        ASSERT(g_memSubsystemUsers > 0);
+        if (--g_memSubsystemUsers == 0) {
+            PoolManager::Finalize();
+            mem::MemConfig::Finalize();
+        }
+    }
+
     delete cfg->options;
     delete cfg;
 }
@@ -418,6 +533,7 @@ static es2panda_Context *CreateContext(es2panda_Config *config, std::string cons
 {
     auto *cfg = reinterpret_cast<ConfigImpl *>(config);
     auto *res = new Context;
+    res->config = cfg;
     res->input = source;
     res->sourceFileName = fileName;
 
@@ -429,8 +545,10 @@ static es2panda_Context *CreateContext(es2panda_Config *config, std::string cons
         auto *varbinder = res->allocator->New<varbinder::ETSBinder>(res->allocator);
         res->parserProgram = new parser::Program(res->allocator, varbinder);
         res->parserProgram->MarkEntry();
-        res->parser =
+        auto *parser =
             new parser::ETSParser(res->parserProgram, cfg->options->CompilerOptions(), parser::ParserStatus::NO_OPTS);
+        parser->SetSourceCache(&cfg->sourceCache);
+        res->parser = parser;
         res->checker = new checker::ETSChecker();
         res->analyzer = new checker::ETSAnalyzer(res->checker);
         res->checker->SetAnalyzer(res->analyzer);
@@ -698,6 +816,7 @@ extern "C" es2panda_Context *ProceedToState(es2panda_Context *context, es2panda_
 extern "C" void DestroyContext(es2panda_Context *context)
 {
     auto *ctx = reinterpret_cast<Context *>(context);
+    ctx->phases.clear();
     delete ctx->program;
     delete ctx->emitter;
     delete ctx->compilerContext;
@@ -723,6 +842,17 @@ extern "C" char const *ContextErrorMessage(es2panda_Context *context)
     return s->errorMessage.c_str();
 }
 
+extern "C" void ContextMemoryUsage(es2panda_Context *context, size_t *limitP, size_t *usedP, size_t *peakP)
+{
+    auto *ctx = reinterpret_cast<Context *>(context);
+    {
+        std::lock_guard<std::mutex> lock(g_memSubsystemMutex);
+        *limitP = g_memSubsystemLimit * 1_MB;
+    }
+    *usedP = ctx->allocator == nullptr ? 0 : ctx->allocator->GetAllocatedSize();
+    *peakP = std::max(ctx->memoryPeak, *usedP);
+}
+
 extern "C" es2panda_Program *ContextProgram(es2panda_Context *context)
 {
     auto *ctx = reinterpret_cast<Context *>(context);
@@ -826,6 +956,109 @@ extern "C" void AstNodeForEach(es2panda_AstNode *ast, void (*func)(es2panda_AstN
     node->IterateRecursively([=](ir::AstNode *child) { func(reinterpret_cast<es2panda_AstNode *>(child), arg); });
 }
 
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#define NODE_KIND_NAME(nodeType, className) #nodeType,
+#define REINTERPRET_NODE_KIND_NAMES(nodeType1, nodeType2, baseClass, reinterpretClass) #nodeType1, #nodeType2,
+// Indexed by ir::AstNodeType, in the order the enum is declared
+static constexpr std::array AST_NODE_KIND_NAMES {
+    AST_NODE_MAPPING(NODE_KIND_NAME) AST_NODE_REINTERPRET_MAPPING(REINTERPRET_NODE_KIND_NAMES)};
+#undef REINTERPRET_NODE_KIND_NAMES
+#undef NODE_KIND_NAME
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+extern "C" int AstNodeKindFromName(char const *name)
+{
+    auto found = std::find_if(AST_NODE_KIND_NAMES.begin(), AST_NODE_KIND_NAMES.end(),
+                              [name](char const *kindName) { return std::strcmp(kindName, name) == 0; });
+    return found == AST_NODE_KIND_NAMES.end() ? -1 : static_cast<int>(found - AST_NODE_KIND_NAMES.begin());
+}
+
+extern "C" char const *AstNodeKindName(int kind)
+{
+    if (kind < 0 || static_cast<size_t>(kind) >= AST_NODE_KIND_NAMES.size()) {
+        return nullptr;
+    }
+    return AST_NODE_KIND_NAMES[kind];
+}
+
+extern "C" int AstNodeKind(es2panda_AstNode *ast)
+{
+    auto *node = reinterpret_cast<ir::AstNode *>(ast);
+    return static_cast<int>(node->Type());
+}
+
+extern "C" es2panda_AstNode *const *AstNodeCollect(es2panda_Context *context, es2panda_AstNode *ast, int const *kinds,
+                                                   size_t nKinds, size_t *sizeP)
+{
+    auto *ctx = reinterpret_cast<Context *>(context);
+    if (ctx->astCollectionsState != ctx->state || ctx->astCollectionsPhase != ctx->currentPhase) {
+        ctx->astCollections.clear();
+        ctx->astCollectionsState = ctx->state;
+        ctx->astCollectionsPhase = ctx->currentPhase;
+    }
+
+    auto *node = reinterpret_cast<ir::AstNode *>(ast);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::vector<int> key(kinds, kinds + nKinds);
+    std::sort(key.begin(), key.end());
+    key.erase(std::unique(key.begin(), key.end()), key.end());
+
+    auto [it, inserted] = ctx->astCollections.try_emplace({node, std::move(key)});
+    auto &nodes = it->second;
+    if (inserted) {
+        const auto &requested = it->first.second;
+        std::vector<bool> mask(AST_NODE_KIND_NAMES.size(), requested.empty());
+        for (int kind : requested) {
+            if (kind >= 0 && static_cast<size_t>(kind) < mask.size()) {
+                mask[kind] = true;
+            }
+        }
+
+        auto collect = [&nodes, &mask](ir::AstNode *child) {
+            if (mask[static_cast<size_t>(child->Type())]) {
+                nodes.push_back(child);
+            }
+        };
+        collect(node);
+        node->IterateRecursively(collect);
+    }
+
+    *sizeP = nodes.size();
+    return reinterpret_cast<es2panda_AstNode *const *>(nodes.data());
+}
+
+extern "C" void AstNodeCollectionsInvalidate(es2panda_Context *context)
+{
+    auto *ctx = reinterpret_cast<Context *>(context);
+    ctx->astCollections.clear();
+}
+
+extern "C" void AstNodesKinds(es2panda_AstNode *const *nodes, size_t nNodes, int *kinds)
+{
+    for (size_t i = 0; i < nNodes; i++) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        kinds[i] = AstNodeKind(nodes[i]);
+    }
+}
+
+extern "C" void AstNodesParents(es2panda_AstNode *const *nodes, size_t nNodes, es2panda_AstNode **parents)
+{
+    for (size_t i = 0; i < nNodes; i++) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto *node = reinterpret_cast<ir::AstNode *>(nodes[i]);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        parents[i] = reinterpret_cast<es2panda_AstNode *>(node->Parent());
+    }
+}
+
+extern "C" void AstNodesTypes(es2panda_AstNode *const *nodes, size_t nNodes, es2panda_Type **types)
+{
+    for (size_t i = 0; i < nNodes; i++) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        types[i] = AstNodeType(nodes[i]);
+    }
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define IS(public_name, e2p_name)                          \
     extern "C" bool Is##public_name(es2panda_AstNode *ast) \
@@ -937,7 +1170,7 @@ extern "C" void AsExpressionSetTypeAnnotation(es2panda_AstNode *ast, es2panda_As
     node->SetTsTypeAnnotation(tp);
 }
 
-static constexpr std::array<TokenTypeToStr, 18U> ASSIGNMENT_TOKEN_TYPES {
+static constexpr std::array<TokenTypeToStr, 16U> ASSIGNMENT_TOKEN_TYPES {
     {{lexer::TokenType::PUNCTUATOR_SUBSTITUTION, "="},
      {lexer::TokenType::PUNCTUATOR_UNSIGNED_RIGHT_SHIFT_EQUAL, ">>>="},
      {lexer::TokenType::PUNCTUATOR_RIGHT_SHIFT_EQUAL, ">>="},
@@ -953,8 +1186,8 @@ static constexpr std::array<TokenTypeToStr, 18U> ASSIGNMENT_TOKEN_TYPES {
      {lexer::TokenType::PUNCTUATOR_LOGICAL_AND_EQUAL, "&&="},
      {lexer::TokenType::PUNCTUATOR_LOGICAL_OR_EQUAL, "||="},
      {lexer::TokenType::PUNCTUATOR_LOGICAL_NULLISH_EQUAL, "\?\?="},
-     {lexer::TokenType::PUNCTUATOR_EXPONENTIATION_EQUAL, "**="},
-     {lexer::TokenType::EOS, nullptr}}};
+     {lexer::TokenType::PUNCTUATOR_EXPONENTIATION_EQUAL, "**="}}};
+static constexpr TokenTable<ASSIGNMENT_TOKEN_TYPES.size()> ASSIGNMENT_TOKEN_TABLE {ASSIGNMENT_TOKEN_TYPES};
 
 extern "C" es2panda_AstNode *CreateAssignmentExpression(es2panda_Context *context, es2panda_AstNode *left,
                                                         es2panda_AstNode *right, char const *operatorType)
@@ -963,7 +1196,7 @@ extern "C" es2panda_AstNode *CreateAssignmentExpression(es2panda_Context *contex
     auto *allocator = ctx->allocator;
     auto *leftNode = reinterpret_cast<ir::AstNode *>(left)->AsExpression();
     auto *rightNode = reinterpret_cast<ir::AstNode *>(right)->AsExpression();
-    lexer::TokenType tok = StrToToken(ASSIGNMENT_TOKEN_TYPES.data(), operatorType);
+    lexer::TokenType tok = ASSIGNMENT_TOKEN_TABLE.Token(operatorType);
     return reinterpret_cast<es2panda_AstNode *>(allocator->New<ir::AssignmentExpression>(leftNode, rightNode, tok));
 }
 
@@ -982,17 +1215,17 @@ extern "C" es2panda_AstNode *AssignmentExpressionRight(es2panda_AstNode *ast)
 extern "C" char const *AssignmentExpressionOperatorType(es2panda_AstNode *ast)
 {
     auto *node = reinterpret_cast<ir::AstNode *>(ast)->AsAssignmentExpression();
-    return TokenToStr(ASSIGNMENT_TOKEN_TYPES.data(), node->OperatorType());
+    return ASSIGNMENT_TOKEN_TABLE.Str(node->OperatorType());
 }
 
 extern "C" void AssignmentExpressionSetOperatorType(es2panda_AstNode *ast, char const *operatorType)
 {
     auto *node = reinterpret_cast<ir::AstNode *>(ast)->AsAssignmentExpression();
-    auto tok = StrToToken(ASSIGNMENT_TOKEN_TYPES.data(), operatorType);
+    auto tok = ASSIGNMENT_TOKEN_TABLE.Token(operatorType);
     node->SetOperatorType(tok);
 }
 
-static constexpr std::array<TokenTypeToStr, 26U> BINARY_OP_TOKEN_TYPES {
+static constexpr std::array<TokenTypeToStr, 25U> BINARY_OP_TOKEN_TYPES {
     {{lexer::TokenType::PUNCTUATOR_UNSIGNED_RIGHT_SHIFT, ">>>"},
      {lexer::TokenType::PUNCTUATOR_RIGHT_SHIFT, ">>"},
      {lexer::TokenType::PUNCTUATOR_LEFT_SHIFT, "<<"},
@@ -1017,8 +1250,8 @@ static constexpr std::array<TokenTypeToStr, 26U> BINARY_OP_TOKEN_TYPES {
      {lexer::TokenType::PUNCTUATOR_GREATER_THAN, ">"},
      {lexer::TokenType::PUNCTUATOR_GREATER_THAN_EQUAL, ">="},
      {lexer::TokenType::KEYW_IN, "in"},
-     {lexer::TokenType::KEYW_INSTANCEOF, "instanceof"},
-     {lexer::TokenType::EOS, nullptr}}};
+     {lexer::TokenType::KEYW_INSTANCEOF, "instanceof"}}};
+static constexpr TokenTable<BINARY_OP_TOKEN_TYPES.size()> BINARY_OP_TOKEN_TABLE {BINARY_OP_TOKEN_TYPES};
 
 extern "C" es2panda_AstNode *CreateBinaryExpression(es2panda_Context *context, es2panda_AstNode *left,
                                                     es2panda_AstNode *right, char const *operatorType)
@@ -1027,7 +1260,7 @@ extern "C" es2panda_AstNode *CreateBinaryExpression(es2panda_Context *context, e
     auto *allocator = ctx->allocator;
     auto *leftExpr = reinterpret_cast<ir::AstNode *>(left)->AsExpression();
     auto *rightExpr = reinterpret_cast<ir::AstNode *>(right)->AsExpression();
-    auto tok = StrToToken(BINARY_OP_TOKEN_TYPES.data(), operatorType);
+    auto tok = BINARY_OP_TOKEN_TABLE.Token(operatorType);
 
     return reinterpret_cast<es2panda_AstNode *>(allocator->New<ir::BinaryExpression>(leftExpr, rightExpr, tok));
 }
@@ -1047,13 +1280,13 @@ extern "C" es2panda_AstNode *BinaryExpressionRight(es2panda_AstNode *ast)
 extern "C" char const *BinaryExpressionOperator(es2panda_AstNode *ast)
 {
     auto *node = reinterpret_cast<ir::AstNode *>(ast)->AsBinaryExpression();
-    return TokenToStr(BINARY_OP_TOKEN_TYPES.data(), node->OperatorType());
+    return BINARY_OP_TOKEN_TABLE.Str(node->OperatorType());
 }
 
 extern "C" void BinaryExpressionSetOperator(es2panda_AstNode *ast, char const *operatorType)
 {
     auto *node = reinterpret_cast<ir::AstNode *>(ast)->AsBinaryExpression();
-    auto op = StrToToken(BINARY_OP_TOKEN_TYPES.data(), operatorType);
+    auto op = BINARY_OP_TOKEN_TABLE.Token(operatorType);
     node->SetOperator(op);
 }
 
@@ -1444,7 +1677,7 @@ extern "C" es2panda_AstNode *CreateIdentifier(es2panda_Context *context, char co
 {
     auto *ctx = reinterpret_cast<Context *>(context);
     auto *allocator = ctx->allocator;
-    auto *nameCopy = ArenaStrdup(ctx->allocator, name);
+    auto *nameCopy = InternCString(ctx, name);
     auto *tpAnn = typeAnnotations == nullptr
                       ? nullptr
                       : reinterpret_cast<ir::AstNode *>(typeAnnotations)->AsExpression()->AsTypeNode();
@@ -1460,7 +1693,7 @@ extern "C" char const *IdentifierName(es2panda_Context *context, es2panda_AstNod
     auto *id = reinterpret_cast<ir::AstNode *>(identifier);
     ASSERT(id->IsIdentifier());
 
-    return StringViewToCString(ctx->allocator, id->AsIdentifier()->Name());
+    return StringViewToCString(ctx, id->AsIdentifier()->Name());
 }
 
 extern "C" es2panda_AstNode *IdentifierTypeAnnotation(es2panda_AstNode *identifier)
@@ -2102,7 +2335,7 @@ extern "C" es2panda_AstNode *CreateStringLiteral(es2panda_Context *context, char
 {
     auto *ctx = reinterpret_cast<Context *>(context);
     auto *allocator = ctx->allocator;
-    auto *str = ArenaStrdup(allocator, string);
+    auto *str = InternCString(ctx, string);
 
     return reinterpret_cast<es2panda_AstNode *>(allocator->New<ir::StringLiteral>(str));
 }
@@ -2110,9 +2343,8 @@ extern "C" es2panda_AstNode *CreateStringLiteral(es2panda_Context *context, char
 extern "C" char const *StringLiteralString(es2panda_Context *context, es2panda_AstNode *ast)
 {
     auto *ctx = reinterpret_cast<Context *>(context);
-    auto *allocator = ctx->allocator;
     auto *node = reinterpret_cast<ir::AstNode *>(ast)->AsStringLiteral();
-    return StringViewToCString(allocator, node->Str());
+    return StringViewToCString(ctx, node->Str());
 }
 
 extern "C" es2panda_AstNode *CreateThisExpression(es2panda_Context *context)
@@ -2633,13 +2865,24 @@ es2panda_Impl g_impl = {
     CreateVariableDeclarator,
     VariableDeclaratorIdentifier,
     VariableDeclaratorInitializer,
+
+    AstNodeKindFromName,
+    AstNodeKindName,
+    AstNodeKind,
+    AstNodeCollect,
+    AstNodeCollectionsInvalidate,
+    AstNodesKinds,
+    AstNodesParents,
+    AstNodesTypes,
+    ContextMemoryUsage,
 };
 
 }  // namespace ark::es2panda::public_lib
 
 extern "C" es2panda_Impl const *es2panda_GetImpl(int version)
 {
-    if (version != ES2PANDA_LIB_VERSION) {
+    // Members of newer versions are only appended, the implementation serves the layout of every older version
+    if (version < 1 || version > ES2PANDA_LIB_VERSION) {
         return nullptr;
     }
     return &ark::es2panda::public_lib::g_impl;
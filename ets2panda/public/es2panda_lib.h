@@ -26,7 +26,7 @@
 extern "C" {
 #endif
 
-#define ES2PANDA_LIB_VERSION 1
+#define ES2PANDA_LIB_VERSION 2
 
 typedef struct es2panda_Config es2panda_Config;
 typedef struct es2panda_Context es2panda_Context;
@@ -119,6 +119,8 @@ typedef enum es2panda_MemberExpressionKind es2panda_MemberExpressionKind;
 struct es2panda_Impl {
     int version;
 
+    // Configs and their contexts may be used from several threads. The memory limit and the log level are process
+    // wide: while a config is alive, creating one with a different --compiler-memory-limit or --log-level fails
     es2panda_Config *(*CreateConfig)(int argc, char const **argv);
     void (*DestroyConfig)(es2panda_Config *config);
 
@@ -417,6 +419,25 @@ struct es2panda_Impl {
                                                   es2panda_AstNode *initializer);
     es2panda_AstNode *(*VariableDeclaratorIdentifier)(es2panda_AstNode *ast);
     es2panda_AstNode *(*VariableDeclaratorInitializer)(es2panda_AstNode *ast);
+
+    // Members added in version 2, appended to keep the layout of version 1
+    // Node kinds are the node type names of the compiler, e.g. "CALL_EXPRESSION"; unknown names give -1
+    int (*AstNodeKindFromName)(char const *name);
+    char const *(*AstNodeKindName)(int kind);
+    int (*AstNodeKind)(es2panda_AstNode *ast);
+    // Pre-order list of the nodes under ast (inclusive) whose kind is one of kinds, all nodes if n_kinds is 0.
+    // The list is owned by the context and reused for equal requests until the context moves to another phase
+    // or AstNodeCollectionsInvalidate is called. Edits of the AST are not tracked: a plugin that modifies the AST
+    // must call AstNodeCollectionsInvalidate itself before collecting again
+    es2panda_AstNode *const *(*AstNodeCollect)(es2panda_Context *context, es2panda_AstNode *ast, int const *kinds,
+                                               size_t n_kinds, size_t *size_p);
+    void (*AstNodeCollectionsInvalidate)(es2panda_Context *context);
+    void (*AstNodesKinds)(es2panda_AstNode *const *nodes, size_t n_nodes, int *kinds);
+    void (*AstNodesParents)(es2panda_AstNode *const *nodes, size_t n_nodes, es2panda_AstNode **parents);
+    void (*AstNodesTypes)(es2panda_AstNode *const *nodes, size_t n_nodes, es2panda_Type **types);
+    // Bytes of the compiler memory space shared by all contexts, and bytes of the context arena in use now and at
+    // the end of the phase that used the most so far
+    void (*ContextMemoryUsage)(es2panda_Context *context, size_t *limit_p, size_t *used_p, size_t *peak_p);
 };
 
 struct es2panda_Impl const *es2panda_GetImpl(int version);
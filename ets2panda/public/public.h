@@ -27,6 +27,12 @@
 #include "checker/checker.h"
 #include "compiler/core/emitter.h"
 #include "util/options.h"
+#include "util/sourceCache.h"
+
+#include <map>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
 
 namespace ark::es2panda::compiler {
 class Phase;
@@ -35,6 +41,7 @@ class Phase;
 namespace ark::es2panda::public_lib {
 struct ConfigImpl {
     util::Options *options;
+    util::SourceCache sourceCache;
 };
 
 struct Context {
@@ -45,7 +52,7 @@ struct Context {
     ArenaAllocator *allocator = nullptr;
     compiler::CompileQueue *queue = nullptr;
     std::vector<util::Plugin> const *plugins = nullptr;
-    std::vector<compiler::Phase *> phases;
+    std::vector<std::unique_ptr<compiler::Phase>> phases;
     size_t currentPhase = 0;
 
     parser::Program *parserProgram = nullptr;
@@ -59,6 +66,15 @@ struct Context {
     es2panda_ContextState state = ES2PANDA_STATE_NEW;
     std::string errorMessage;
     lexer::SourcePosition errorPos;
+
+    // Node lists handed out by AstNodeCollect, keyed by the root node and the requested kinds
+    std::map<std::pair<ir::AstNode *, std::vector<int>>, std::vector<ir::AstNode *>> astCollections;
+    es2panda_ContextState astCollectionsState = ES2PANDA_STATE_NEW;
+    size_t astCollectionsPhase = 0;
+    // C strings handed out by the name accessors, see InternCString
+    std::unordered_map<std::string_view, char const *> cStrings;
+    // Most bytes of the arena in use after any phase so far, see Phase::Apply
+    size_t memoryPeak = 0;
 };
 }  // namespace ark::es2panda::public_lib
 
@@ -0,0 +1,67 @@
+#!/usr/bin/env bash
+# Copyright (c) 2024 Huawei Device Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+set -e
+
+usage() {
+    echo "Usage: $0 path/to/panda/build/bin/declgen_ets2ts path/to/project [PANDA_RUN_PREFIX] [PANDA_ROOT]"
+}
+
+ensure_exists() {
+    if [ ! -f "$1" ]; then
+        echo "Error: No such file: '$1'"
+        usage
+        exit 1
+    fi
+}
+
+DECLGEN="$1"
+PROJECT_DIR="$(realpath "$2")"
+PANDA_RUN_PREFIX="$3"
+PANDA_ROOT="$4"
+TSCONFIG="$PROJECT_DIR"/tsconfig.json
+BUILD="$PROJECT_DIR"/build
+STDLIB="$PANDA_ROOT/plugins/ets/stdlib"
+
+ensure_exists "$TSCONFIG"
+ensure_exists "$DECLGEN"
+
+rm -r -f "$BUILD"
+
+# The whole project at once, declarations are written to the output directory of the project
+CMD="$PANDA_RUN_PREFIX $DECLGEN --stdlib=$STDLIB --arktsconfig=$TSCONFIG"
+$CMD
+
+# Every source on its own, declarations are written to the same relative paths
+PER_FILE=$(mktemp -d /tmp/declgen.XXXXXX)
+pushd "$PROJECT_DIR" &> /dev/null
+for SRC in $(find . -path ./build -prune -o -type f -name '*.ets' -print | sort); do
+    OUT="$PER_FILE/${SRC%.ets}.d.ts"
+    mkdir -p "$(dirname "$OUT")"
+    $CMD --output="$OUT" "$SRC"
+done
+popd &> /dev/null
+
+set +e
+/usr/bin/diff -r "$PER_FILE" "$BUILD"
+RES=$?
+set -e
+if [ "$RES" -ne 0 ]; then
+    echo "Declarations of the project differ from the ones generated file by file"
+    echo "How to reproduce:"
+    echo "(cd $(pwd) && $CMD)"
+fi
+rm -r "$PER_FILE"
+rm -r "$BUILD"
+exit $RES
@@ -14,6 +14,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
 #include "macros.h"
 #include "public/es2panda_lib.h"
 #include "test/utils/panda_executable_path_getter.h"
@@ -102,3 +104,280 @@ function main() {
 
     impl_->DestroyContext(ctx);
 }
+
+TEST_F(Es2PandaLibTest, AstNodeKinds)
+{
+    int kind = impl_->AstNodeKindFromName("SCRIPT_FUNCTION");
+    ASSERT_GE(kind, 0);
+    ASSERT_EQ(std::string(impl_->AstNodeKindName(kind)), "SCRIPT_FUNCTION");
+    ASSERT_EQ(impl_->AstNodeKindFromName("NO_SUCH_NODE"), -1);
+    ASSERT_EQ(impl_->AstNodeKindName(-1), nullptr);
+}
+
+TEST_F(Es2PandaLibTest, AstNodeCollect)
+{
+    char const *text = R"XXX(
+function add(a: int, b: int): int { return a + b }
+function main() { let s = add(1, 2) }
+)XXX";
+    es2panda_Context *ctx = impl_->CreateContextFromString(cfg_, text, "collect.ets");
+    ctx = impl_->ProceedToState(ctx, ES2PANDA_STATE_CHECKED);
+    ASSERT_EQ(impl_->ContextState(ctx), ES2PANDA_STATE_CHECKED);
+    auto *ast = impl_->ProgramAst(impl_->ContextProgram(ctx));
+
+    size_t size = 0;
+    auto *nodes = impl_->AstNodeCollect(ctx, ast, nullptr, 0, &size);
+    ASSERT_GT(size, 1U);
+    ASSERT_EQ(*nodes, ast);
+
+    std::vector<int> kinds(size);
+    std::vector<es2panda_AstNode *> parents(size);
+    std::vector<es2panda_Type *> types(size);
+    impl_->AstNodesKinds(nodes, size, kinds.data());
+    impl_->AstNodesParents(nodes, size, parents.data());
+    impl_->AstNodesTypes(nodes, size, types.data());
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(kinds[i], impl_->AstNodeKind(nodes[i]));
+        ASSERT_EQ(types[i], impl_->AstNodeType(nodes[i]));
+        ASSERT_TRUE(i == 0 || parents[i] != nullptr);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    // The same request, even with the kinds repeated, is answered from the cache
+    int identifier = impl_->AstNodeKindFromName("IDENTIFIER");
+    std::vector<int> repeated {identifier, identifier};
+    size_t identifiers = 0;
+    auto *collected = impl_->AstNodeCollect(ctx, ast, &identifier, 1, &identifiers);
+    ASSERT_EQ(impl_->AstNodeCollect(ctx, ast, repeated.data(), repeated.size(), &size), collected);
+    ASSERT_EQ(size, identifiers);
+    ASSERT_EQ(static_cast<size_t>(std::count(kinds.begin(), kinds.end(), identifier)), identifiers);
+
+    impl_->DestroyContext(ctx);
+}
+
+TEST_F(Es2PandaLibTest, AstNodeCollectionsInvalidate)
+{
+    char const *text = "function add(a: int, b: int): int { return a + b }";
+    es2panda_Context *ctx = impl_->CreateContextFromString(cfg_, text, "invalidate.ets");
+    ctx = impl_->ProceedToState(ctx, ES2PANDA_STATE_PARSED);
+    ASSERT_EQ(impl_->ContextState(ctx), ES2PANDA_STATE_PARSED);
+    auto *ast = impl_->ProgramAst(impl_->ContextProgram(ctx));
+
+    int function = impl_->AstNodeKindFromName("SCRIPT_FUNCTION");
+    int identifier = impl_->AstNodeKindFromName("IDENTIFIER");
+    size_t size = 0;
+    auto *functions = impl_->AstNodeCollect(ctx, ast, &function, 1, &size);
+    es2panda_AstNode *add = nullptr;
+    for (size_t i = 0; i < size; i++) {
+        size_t params = 0;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto *func = functions[i];
+        impl_->ScriptFunctionParams(func, &params);
+        add = params == 2U ? func : add;
+    }
+    ASSERT_NE(add, nullptr);
+
+    size_t identifiers = 0;
+    impl_->AstNodeCollect(ctx, ast, &identifier, 1, &identifiers);
+
+    // Edits of the AST are not tracked, the stale list is returned until it is invalidated
+    impl_->ScriptFunctionSetParams(add, nullptr, 0);
+    impl_->AstNodeCollect(ctx, ast, &identifier, 1, &size);
+    ASSERT_EQ(size, identifiers);
+
+    impl_->AstNodeCollectionsInvalidate(ctx);
+    impl_->AstNodeCollect(ctx, ast, &identifier, 1, &size);
+    ASSERT_EQ(size, identifiers - 2U);
+
+    impl_->DestroyContext(ctx);
+}
+
+TEST_F(Es2PandaLibTest, CheckSignaturesOnly)
+{
+    char const *annotated = "function f(): int { let s: string = 1; return 0 }";
+    char const *inferred = "function g() { let s: string = 1; return 0 }";
+
+    auto es2pandaPath = test::utils::PandaExecutablePathGetter {}.Get();
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    char const *argv[] = {es2pandaPath.c_str(), "--check-signatures-only"};
+    es2panda_Config *cfg = impl_->CreateConfig(2, argv);
+    ASSERT_NE(cfg, nullptr);
+
+    // The body of a function with an explicit return type is skipped
+    es2panda_Context *ctx = impl_->CreateContextFromString(cfg, annotated, "signatures-only.ets");
+    ctx = impl_->ProceedToState(ctx, ES2PANDA_STATE_CHECKED);
+    ASSERT_EQ(impl_->ContextState(ctx), ES2PANDA_STATE_CHECKED);
+    impl_->DestroyContext(ctx);
+
+    // The body the return type is inferred from is still checked
+    ctx = impl_->CreateContextFromString(cfg, inferred, "signatures-only.ets");
+    ctx = impl_->ProceedToState(ctx, ES2PANDA_STATE_CHECKED);
+    ASSERT_EQ(impl_->ContextState(ctx), ES2PANDA_STATE_ERROR);
+    impl_->DestroyContext(ctx);
+    impl_->DestroyConfig(cfg);
+
+    ctx = impl_->CreateContextFromString(cfg_, annotated, "signatures-only.ets");
+    ctx = impl_->ProceedToState(ctx, ES2PANDA_STATE_CHECKED);
+    ASSERT_EQ(impl_->ContextState(ctx), ES2PANDA_STATE_ERROR);
+    impl_->DestroyContext(ctx);
+}
+
+TEST_F(Es2PandaLibTest, ContextMemoryUsage)
+{
+    constexpr size_t DEFAULT_LIMIT = 256U * 1024U * 1024U;
+    es2panda_Context *ctx = impl_->CreateContextFromString(cfg_, "function main() {}", "memory-usage.ets");
+    ctx = impl_->ProceedToState(ctx, ES2PANDA_STATE_ASM_GENERATED);
+    ASSERT_EQ(impl_->ContextState(ctx), ES2PANDA_STATE_ASM_GENERATED);
+
+    size_t limit = 0;
+    size_t used = 0;
+    size_t peak = 0;
+    impl_->ContextMemoryUsage(ctx, &limit, &used, &peak);
+    ASSERT_EQ(limit, DEFAULT_LIMIT);
+    ASSERT_GT(used, 0U);
+    ASSERT_GE(peak, used);
+    ASSERT_LT(peak, limit);
+    impl_->DestroyContext(ctx);
+}
+
+TEST_F(Es2PandaLibTest, ConcurrentContexts)
+{
+    constexpr size_t THREADS = 4U;
+    constexpr size_t ROUNDS = 3U;
+    char const *text = R"XXX(
+class A { n: int = 1 }
+class B extends A { m(): int { return this.n + 1 } }
+function main() {
+    let local = new B
+    class Local { v: string = "local" }
+    console.log(local.m() + new Local().v)
+}
+)XXX";
+
+    auto es2pandaPath = test::utils::PandaExecutablePathGetter {}.Get();
+    std::vector<es2panda_ContextState> states(THREADS * ROUNDS, ES2PANDA_STATE_NEW);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREADS; t++) {
+        threads.emplace_back([this, t, text, &es2pandaPath, &states]() {
+            // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+            char const *argv[] = {es2pandaPath.c_str()};
+            es2panda_Config *cfg = impl_->CreateConfig(1, argv);
+            for (size_t r = 0; r < ROUNDS; r++) {
+                es2panda_Context *ctx = impl_->CreateContextFromString(cfg, text, "concurrent.ets");
+                ctx = impl_->ProceedToState(ctx, ES2PANDA_STATE_ASM_GENERATED);
+                states[t * ROUNDS + r] = impl_->ContextState(ctx);
+                impl_->DestroyContext(ctx);
+            }
+            impl_->DestroyConfig(cfg);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (auto state : states) {
+        ASSERT_EQ(state, ES2PANDA_STATE_ASM_GENERATED);
+    }
+}
+
+TEST_F(Es2PandaLibTest, ConflictingConfig)
+{
+    auto es2pandaPath = test::utils::PandaExecutablePathGetter {}.Get();
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    char const *sameArgv[] = {es2pandaPath.c_str(), "--log-level=error"};
+    es2panda_Config *same = impl_->CreateConfig(2, sameArgv);
+    ASSERT_NE(same, nullptr);
+    impl_->DestroyConfig(same);
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    char const *otherArgv[] = {es2pandaPath.c_str(), "--log-level=debug"};
+    ASSERT_EQ(impl_->CreateConfig(2, otherArgv), nullptr);
+}
+
+TEST_F(Es2PandaLibTest, OperatorTokensRoundTrip)
+{
+    std::vector<std::string> assignmentOps {"=",  ">>>=", ">>=", "<<=", "+=",  "-=",  "*=",  "/=",
+                                            "%=", "&=",   "|=",  "^=",  "&&=", "||=", "??=", "**="};
+    std::vector<std::string> binaryOps {">>>", ">>", "<<", "+",  "-",   "*",   "/", "%",  "&",
+                                        "|",   "^",  "&&", "||", "??",  "**",  "==", "/=", "===",
+                                        "/==", "<",  "<=", ">",  ">=",  "in",  "instanceof"};
+
+    es2panda_Context *ctx = impl_->CreateContextFromString(cfg_, "function main() {}", "operators.ets");
+    ctx = impl_->ProceedToState(ctx, ES2PANDA_STATE_PARSED);
+    ASSERT_EQ(impl_->ContextState(ctx), ES2PANDA_STATE_PARSED);
+    auto *left = impl_->CreateIdentifier(ctx, "a", nullptr);
+    auto *right = impl_->CreateIdentifier(ctx, "b", nullptr);
+
+    // Every operator is resolved to its token and back, also after it is replaced by the setter
+    for (const auto &op : assignmentOps) {
+        auto *expr = impl_->CreateAssignmentExpression(ctx, left, right, op.c_str());
+        ASSERT_EQ(std::string(impl_->AssignmentExpressionOperatorType(expr)), op);
+        impl_->AssignmentExpressionSetOperatorType(expr, assignmentOps.back().c_str());
+        impl_->AssignmentExpressionSetOperatorType(expr, op.c_str());
+        ASSERT_EQ(std::string(impl_->AssignmentExpressionOperatorType(expr)), op);
+    }
+
+    for (const auto &op : binaryOps) {
+        auto *expr = impl_->CreatebinaryExpression(ctx, left, right, op.c_str());
+        ASSERT_EQ(std::string(impl_->BinaryExpressionOperator(expr)), op);
+        impl_->BinaryExpressionSetOperator(expr, binaryOps.back().c_str());
+        impl_->BinaryExpressionSetOperator(expr, op.c_str());
+        ASSERT_EQ(std::string(impl_->BinaryExpressionOperator(expr)), op);
+    }
+
+    impl_->DestroyContext(ctx);
+}
+
+TEST_F(Es2PandaLibTest, InternedStringsAreStable)
+{
+    es2panda_Context *ctx =
+        impl_->CreateContextFromString(cfg_, "function main() { let first = 1; let second = first }", "interned.ets");
+    ctx = impl_->ProceedToState(ctx, ES2PANDA_STATE_PARSED);
+    ASSERT_EQ(impl_->ContextState(ctx), ES2PANDA_STATE_PARSED);
+
+    struct Arg {
+        es2panda_Impl const *impl = nullptr;
+        es2panda_Context *ctx = nullptr;
+        std::vector<char const *> names;
+    };
+    auto collect = [](es2panda_AstNode *ast, void *argp) {
+        auto *a = reinterpret_cast<Arg *>(argp);
+        if (a->impl->IsIdentifier(ast)) {
+            a->names.push_back(a->impl->IdentifierName(a->ctx, ast));
+        }
+    };
+    Arg parsed {impl_, ctx, {}};
+    impl_->AstNodeForEach(impl_->ProgramAst(impl_->ContextProgram(ctx)), collect, &parsed);
+    std::vector<std::string> expected(parsed.names.begin(), parsed.names.end());
+
+    // Names of parsed identifiers are not NUL-terminated in the source, repeated calls return the same copy
+    Arg again {impl_, ctx, {}};
+    impl_->AstNodeForEach(impl_->ProgramAst(impl_->ContextProgram(ctx)), collect, &again);
+    ASSERT_EQ(parsed.names, again.names);
+
+    // The text passed in is copied, equal text is interned once
+    char const *created = nullptr;
+    {
+        std::string name = "created";
+        created = impl_->IdentifierName(ctx, impl_->CreateIdentifier(ctx, name.c_str(), nullptr));
+    }
+    ASSERT_EQ(impl_->IdentifierName(ctx, impl_->CreateIdentifier(ctx, "created", nullptr)), created);
+    char const *literal = impl_->StringLiteralString(ctx, impl_->CreateStringLiteral(ctx, "literal"));
+
+    // Growing the intern table keeps every string handed out before
+    constexpr size_t STRINGS = 4096U;
+    for (size_t i = 0; i < STRINGS; i++) {
+        auto text = "s" + std::to_string(i);
+        impl_->CreateStringLiteral(ctx, text.c_str());
+    }
+
+    ASSERT_EQ(std::string(created), "created");
+    ASSERT_EQ(std::string(literal), "literal");
+    ASSERT_EQ(impl_->StringLiteralString(ctx, impl_->CreateStringLiteral(ctx, "literal")), literal);
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(std::string(parsed.names[i]), expected[i]);
+    }
+
+    impl_->DestroyContext(ctx);
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "macros.h"
+#include "util/sourceCache.h"
+
+namespace ark::es2panda::util {
+
+class SourceCacheTest : public testing::Test {
+public:
+    SourceCacheTest() : path_(testing::TempDir() + "source_cache_test_" + std::to_string(getpid()) + ".ets") {}
+
+    ~SourceCacheTest() override
+    {
+        std::remove(path_.c_str());
+    }
+
+    NO_COPY_SEMANTIC(SourceCacheTest);
+    NO_MOVE_SEMANTIC(SourceCacheTest);
+
+protected:
+    void Write(const std::string &path, const std::string &text)
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << text;
+    }
+
+    // Pins the modification time, so that edits can be told apart only by the nanoseconds
+    void SetModificationTime(const std::string &path, long nsec)
+    {
+        constexpr time_t SECONDS = 1700000000;
+        // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+        struct timespec times[2] = {{SECONDS, nsec}, {SECONDS, nsec}};
+        ASSERT_EQ(utimensat(AT_FDCWD, path.c_str(), times, 0), 0);
+    }
+
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+    std::string path_;
+    SourceCache cache_;
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+};
+
+TEST_F(SourceCacheTest, MissingFile)
+{
+    ASSERT_EQ(cache_.Read(path_ + ".missing"), nullptr);
+}
+
+TEST_F(SourceCacheTest, HitSharesText)
+{
+    Write(path_, "function main() {}");
+    auto first = cache_.Read(path_);
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(*first, "function main() {}");
+
+    auto second = cache_.Read(path_);
+    ASSERT_EQ(second, first);
+}
+
+TEST_F(SourceCacheTest, InvalidatedByNanoseconds)
+{
+    Write(path_, "let a = 1");
+    SetModificationTime(path_, 100);
+    auto first = cache_.Read(path_);
+    ASSERT_NE(first, nullptr);
+
+    // Same size and the same second, only the nanoseconds differ
+    Write(path_, "let b = 2");
+    SetModificationTime(path_, 200);
+    auto second = cache_.Read(path_);
+    ASSERT_NE(second, nullptr);
+    ASSERT_EQ(*second, "let b = 2");
+    ASSERT_EQ(*first, "let a = 1");
+}
+
+TEST_F(SourceCacheTest, InvalidatedByReplacement)
+{
+    Write(path_, "let a = 1");
+    SetModificationTime(path_, 100);
+    auto first = cache_.Read(path_);
+    ASSERT_NE(first, nullptr);
+
+    // A file renamed over the cached one can carry the very same size and times
+    std::string replacement = path_ + ".new";
+    Write(replacement, "let b = 2");
+    SetModificationTime(replacement, 100);
+    ASSERT_EQ(std::rename(replacement.c_str(), path_.c_str()), 0);
+
+    auto second = cache_.Read(path_);
+    ASSERT_NE(second, nullptr);
+    ASSERT_EQ(*second, "let b = 2");
+}
+
+}  // namespace ark::es2panda::util
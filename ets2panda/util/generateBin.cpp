@@ -14,6 +14,7 @@
  */
 
 #include "generateBin.h"
+#include "inMemoryPandaFile.h"
 #include "bytecode_optimizer/bytecodeopt_options.h"
 #include "bytecode_optimizer/optimize_bytecode.h"
 #include "compiler/compiler_logger.h"
@@ -37,12 +38,18 @@ namespace ark::es2panda::util {
 
 #ifdef PANDA_WITH_BYTECODE_OPTIMIZER
 static int OptimizeBytecode(ark::pandasm::Program *prog, const util::Options *options, const ReporterFun &reporter,
-                            std::map<std::string, size_t> *statp,
                             ark::pandasm::AsmEmitter::PandaFileToPandaAsmMaps *mapsp)
 {
     if (options->OptLevel() != 0) {
         InitializeLogging(options);
-        if (!ark::pandasm::AsmEmitter::Emit(options->CompilerOutput(), *prog, statp, mapsp, true)) {
+
+        // The bytecode optimizer reads the unoptimized binary back by its file name. Emit it into memory where
+        // possible, so only the optimized binary is written to the compiler output.
+        InMemoryPandaFile inMemoryOutput;
+        std::string unoptimizedOutput = inMemoryOutput.PathOr(options->CompilerOutput());
+
+        // Size statistics are collected for the optimized binary only
+        if (!ark::pandasm::AsmEmitter::Emit(unoptimizedOutput, *prog, nullptr, mapsp, true)) {
             reporter("Failed to emit binary data: " + ark::pandasm::AsmEmitter::GetLastError());
             return 1;
         }
@@ -51,7 +58,7 @@ static int OptimizeBytecode(ark::pandasm::Program *prog, const util::Options *op
         // Set default value instead of maximum set in ark::bytecodeopt::SetCompilerOptions()
         ark::compiler::CompilerLogger::Init({"all"});
         ark::compiler::g_options.SetCompilerMaxBytecodeSize(ark::compiler::g_options.GetCompilerMaxBytecodeSize());
-        ark::bytecodeopt::OptimizeBytecode(prog, mapsp, options->CompilerOutput(), options->IsDynamic(), true);
+        ark::bytecodeopt::OptimizeBytecode(prog, mapsp, unoptimizedOutput, options->IsDynamic(), true);
     }
 
     return 0;
@@ -108,7 +115,7 @@ int GenerateProgram(ark::pandasm::Program *prog, const util::Options *options, c
     ark::pandasm::AsmEmitter::PandaFileToPandaAsmMaps *mapsp = options->OptLevel() != 0 ? &maps : nullptr;
 
 #ifdef PANDA_WITH_BYTECODE_OPTIMIZER
-    if (OptimizeBytecode(prog, options, reporter, statp, mapsp) != 0) {
+    if (OptimizeBytecode(prog, options, reporter, mapsp) != 0) {
         return 1;
     }
 #endif
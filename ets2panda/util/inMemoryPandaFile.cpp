@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "inMemoryPandaFile.h"
+
+#ifdef PANDA_TARGET_LINUX
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace ark::es2panda::util {
+
+#ifdef PANDA_TARGET_LINUX
+InMemoryPandaFile::InMemoryPandaFile() : fd_(memfd_create("es2panda_unopt_abc", MFD_CLOEXEC)) {}
+
+InMemoryPandaFile::~InMemoryPandaFile()
+{
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+std::string InMemoryPandaFile::PathOr(const std::string &fallback) const
+{
+    return IsValid() ? "/proc/self/fd/" + std::to_string(fd_) : fallback;
+}
+#else
+InMemoryPandaFile::InMemoryPandaFile() = default;
+
+InMemoryPandaFile::~InMemoryPandaFile() = default;
+
+std::string InMemoryPandaFile::PathOr(const std::string &fallback) const
+{
+    return fallback;
+}
+#endif
+
+}  // namespace ark::es2panda::util
@@ -0,0 +1,48 @@
+/**
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ES2PANDA_UTIL_IN_MEMORY_PANDA_FILE_H
+#define ES2PANDA_UTIL_IN_MEMORY_PANDA_FILE_H
+
+#include "macros.h"
+
+#include <string>
+
+namespace ark::es2panda::util {
+
+// Anonymous memory-backed file for an intermediate binary that is read back by its file name.
+// Memory-backed files exist on Linux only; elsewhere the file is never valid and callers keep their on-disk path.
+class InMemoryPandaFile {
+public:
+    InMemoryPandaFile();
+    NO_COPY_SEMANTIC(InMemoryPandaFile);
+    NO_MOVE_SEMANTIC(InMemoryPandaFile);
+    ~InMemoryPandaFile();
+
+    bool IsValid() const
+    {
+        return fd_ >= 0;
+    }
+
+    // Path of the memory-backed file if it is valid, otherwise the given fallback path
+    std::string PathOr(const std::string &fallback) const;
+
+private:
+    int fd_ {-1};
+};
+
+}  // namespace ark::es2panda::util
+
+#endif
@@ -157,6 +157,10 @@ bool Options::Parse(int argc, const char **argv)
                                              "Parse the input as the given extension (options: js | ts | as | ets)");
     ark::PandArg<bool> opModule("module", false, "Parse the input as module (JS only option)");
     ark::PandArg<bool> opParseOnly("parse-only", false, "Parse the input only");
+    ark::PandArg<bool> opCheckSignaturesOnly(
+        "check-signatures-only", false,
+        "Check declarations and signatures only, skip bodies of functions with an explicit return type "
+        "(declgen and public API only)");
     ark::PandArg<bool> opDumpAst("dump-ast", false, "Dump the parsed AST");
     ark::PandArg<bool> opDumpAstOnlySilent("dump-ast-only-silent", false,
                                            "Dump parsed AST with all dumpers available but don't print to stdout");
@@ -174,6 +178,9 @@ bool Options::Parse(int argc, const char **argv)
     auto constexpr DEFAULT_THREAD_COUNT = 0;
     ark::PandArg<int> opThreadCount("thread", DEFAULT_THREAD_COUNT, "Number of worker threads");
     ark::PandArg<bool> opSizeStat("dump-size-stat", false, "Dump size statistics");
+    auto constexpr DEFAULT_COMPILER_MEMORY_LIMIT = 256U;
+    ark::PandArg<uint32_t> opCompilerMemoryLimit("compiler-memory-limit", DEFAULT_COMPILER_MEMORY_LIMIT,
+                                                 "Size of the compiler memory space in MB");
     ark::PandArg<std::string> outputFile("output", "", "Compiler binary output (.abc)");
     ark::PandArg<std::string> logLevel("log-level", "error", "Log-level");
     ark::PandArg<std::string> stdLib("stdlib", "", "Path to standard library");
@@ -228,6 +235,7 @@ bool Options::Parse(int argc, const char **argv)
     argparser_->Add(&opDumpAstOnlySilent);
     argparser_->Add(&opDumpCheckedAst);
     argparser_->Add(&opParseOnly);
+    argparser_->Add(&opCheckSignaturesOnly);
     argparser_->Add(&opDumpAssembly);
     argparser_->Add(&opDebugInfo);
     argparser_->Add(&opDumpDebugInfo);
@@ -236,6 +244,7 @@ bool Options::Parse(int argc, const char **argv)
     argparser_->Add(&opEtsModule);
     argparser_->Add(&opThreadCount);
     argparser_->Add(&opSizeStat);
+    argparser_->Add(&opCompilerMemoryLimit);
     argparser_->Add(&opListFiles);
 
     argparser_->Add(&inputExtension);
@@ -334,6 +343,12 @@ bool Options::Parse(int argc, const char **argv)
     threadCount_ = opThreadCount.GetValue();
     listFiles_ = opListFiles.GetValue();
 
+    if (opCompilerMemoryLimit.GetValue() == 0) {
+        errorMsg_ = "Error: --compiler-memory-limit must be greater than zero.";
+        return false;
+    }
+    compilerMemoryLimit_ = opCompilerMemoryLimit.GetValue();
+
     // Add Option Flags
     AddOptionFlags(opParseOnly, opModule, opSizeStat);
 
@@ -357,6 +372,7 @@ bool Options::Parse(int argc, const char **argv)
     compilerOptions_.dumpDebugInfo = opDumpDebugInfo.GetValue();
     compilerOptions_.isDebug = opDebugInfo.GetValue();
     compilerOptions_.parseOnly = opParseOnly.GetValue();
+    compilerOptions_.checkSignaturesOnly = opCheckSignaturesOnly.GetValue();
     compilerOptions_.stdLib = stdLib.GetValue();
     compilerOptions_.compilationMode = compilationMode;
     compilerOptions_.isEtsModule = opEtsModule.GetValue();
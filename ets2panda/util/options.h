@@ -248,6 +248,11 @@ public:
         return threadCount_;
     }
 
+    uint32_t CompilerMemoryLimit() const
+    {
+        return compilerMemoryLimit_;
+    }
+
     bool ParseModule() const
     {
         return (options_ & OptionFlags::PARSE_MODULE) != 0;
@@ -285,6 +290,7 @@ private:
     std::string errorMsg_;
     int optLevel_ {0};
     int threadCount_ {0};
+    uint32_t compilerMemoryLimit_ {0};
     bool listFiles_ {false};
     util::LogLevel logLevel_ {util::LogLevel::ERROR};
 };
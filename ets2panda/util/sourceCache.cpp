@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sourceCache.h"
+
+#include <fstream>
+#include <sstream>
+
+#include <sys/stat.h>
+
+namespace ark::es2panda::util {
+
+std::shared_ptr<const std::string> SourceCache::Read(const std::string &path)
+{
+    struct stat st {};
+    if (stat(path.c_str(), &st) != 0) {
+        return nullptr;
+    }
+
+    // Edits within one second keep st_mtime, a file replaced by a rename keeps neither the inode nor the times
+#if defined(PANDA_TARGET_MACOS)
+    int64_t mtimeSec = st.st_mtimespec.tv_sec;
+    int64_t mtimeNsec = st.st_mtimespec.tv_nsec;
+#elif defined(PANDA_TARGET_WINDOWS)
+    int64_t mtimeSec = st.st_mtime;
+    int64_t mtimeNsec = 0;
+#else
+    int64_t mtimeSec = st.st_mtim.tv_sec;
+    int64_t mtimeNsec = st.st_mtim.tv_nsec;
+#endif
+    FileStamp stamp {static_cast<uint64_t>(st.st_dev), static_cast<uint64_t>(st.st_ino),
+                     static_cast<uint64_t>(st.st_size), mtimeSec, mtimeNsec};
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        auto it = entries_.find(path);
+        if (it != entries_.end() && it->second.stamp == stamp) {
+            return it->second.text;
+        }
+    }
+
+    std::ifstream inputStream(path);
+    if (inputStream.fail()) {
+        return nullptr;
+    }
+
+    std::stringstream ss;
+    ss << inputStream.rdbuf();
+    auto text = std::make_shared<const std::string>(ss.str());
+
+    std::lock_guard<std::mutex> lock(m_);
+    entries_.insert_or_assign(path, Entry {stamp, text});
+    return text;
+}
+
+}  // namespace ark::es2panda::util
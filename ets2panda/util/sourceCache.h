@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ES2PANDA_UTIL_SOURCE_CACHE_H
+#define ES2PANDA_UTIL_SOURCE_CACHE_H
+
+#include "macros.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ark::es2panda::util {
+
+// Text of the external sources read by the parser, shared by the compilations of a long-lived config.
+// A cached text is reused while the file keeps its identity, size and modification time to the nanosecond.
+class SourceCache {
+public:
+    SourceCache() = default;
+    NO_COPY_SEMANTIC(SourceCache);
+    NO_MOVE_SEMANTIC(SourceCache);
+    ~SourceCache() = default;
+
+    // Returns nullptr if the file cannot be read; the text stays valid after the file changes
+    std::shared_ptr<const std::string> Read(const std::string &path);
+
+private:
+    struct FileStamp {
+        uint64_t device;
+        uint64_t inode;
+        uint64_t size;
+        int64_t mtimeSec;
+        int64_t mtimeNsec;
+
+        bool operator==(const FileStamp &other) const
+        {
+            return device == other.device && inode == other.inode && size == other.size &&
+                   mtimeSec == other.mtimeSec && mtimeNsec == other.mtimeNsec;
+        }
+    };
+
+    struct Entry {
+        FileStamp stamp;
+        std::shared_ptr<const std::string> text;
+    };
+
+    std::mutex m_;
+    std::unordered_map<std::string, Entry> entries_;
+};
+
+}  // namespace ark::es2panda::util
+
+#endif  // ES2PANDA_UTIL_SOURCE_CACHE_H
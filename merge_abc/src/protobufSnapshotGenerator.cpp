@@ -74,6 +74,10 @@ panda::es2panda::util::ProgramCache *ProtobufSnapshotGenerator::GetCacheContext(
     Program::Deserialize(protoCache.program(), *program, allocator);
     uint32_t hashCode = protoCache.hashcode();
     auto *programCache = allocator->New<panda::es2panda::util::ProgramCache>(hashCode, std::move(*program));
+    for (const auto &[name, functionKey] : protoCache.functionkeys()) {
+        programCache->functionKeys.emplace(name,
+            panda::es2panda::util::FunctionKey {functionKey.hash(), functionKey.length()});
+    }
 
     return programCache;
 }
@@ -85,6 +89,12 @@ void ProtobufSnapshotGenerator::UpdateCacheFile(const panda::es2panda::util::Pro
     protoCache.set_hashcode(programCache->hashCode);
     auto *protoProgram = protoCache.mutable_program();
     Program::Serialize(programCache->program, *protoProgram);
+    auto *protoFunctionKeys = protoCache.mutable_functionkeys();
+    for (const auto &[name, functionKey] : programCache->functionKeys) {
+        auto &protoFunctionKey = (*protoFunctionKeys)[name];
+        protoFunctionKey.set_hash(functionKey.hash);
+        protoFunctionKey.set_length(functionKey.length);
+    }
 
     std::fstream output = panda::es2panda::util::Helpers::FileStream<std::fstream>(
         panda::os::file::File::GetExtendedFilePath(cacheFilePath),